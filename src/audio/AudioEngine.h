@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Platform.h"
 #include "Types.h"
 #include <fmod.hpp>
 #include <fmod_studio.hpp>
@@ -68,4 +69,18 @@ class AudioEngine {
     static FMOD_VECTOR VectorToFmod(const Vector3f& vPosition);
 };
 
+// Binds the simulation's AudioOutput to the FMOD engine above
+class FmodAudioOutput : public AudioOutput {
+  public:
+    void init() override { AudioEngine::Init(); }
+    void update() override { AudioEngine::Update(); }
+    void shutdown() override { AudioEngine::Shutdown(); }
+
+    void loadBank(const std::string& bankName) override { AudioEngine::LoadBank(bankName, 0); }
+    void loadSound(const std::string& soundName) override { AudioEngine::LoadSound(soundName); }
+    int playSound(const std::string& soundName) override { return AudioEngine::PlaySoundFile(soundName); }
+    void stopChannel(int channelId) override { AudioEngine::StopChannel(channelId); }
+    void playEvent(const std::string& eventName) override { AudioEngine::PlayEvent(eventName); }
+};
+
 } // namespace omegarace
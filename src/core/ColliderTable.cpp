@@ -0,0 +1,73 @@
+#include "ColliderTable.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COLLIDER_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define COLLIDER_NEON 1
+#endif
+
+namespace omegarace {
+
+void ColliderTable::clear() {
+    m_X.clear();
+    m_Y.clear();
+    m_Radius.clear();
+    m_Type.clear();
+    m_Owner.clear();
+}
+
+int ColliderTable::add(float x, float y, float radius, uint8_t type, int owner) {
+    m_X.push_back(x);
+    m_Y.push_back(y);
+    m_Radius.push_back(radius);
+    m_Type.push_back(type);
+    m_Owner.push_back(owner);
+    return (int)m_X.size() - 1;
+}
+
+uint32_t CircleOverlapMask(float px, float py, float pr, const float* x, const float* y, const float* r, int count) {
+    uint32_t mask = 0;
+    int i = 0;
+
+#if defined(COLLIDER_SSE2)
+    const __m128 probeX = _mm_set1_ps(px);
+    const __m128 probeY = _mm_set1_ps(py);
+    const __m128 probeR = _mm_set1_ps(pr);
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), probeX);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), probeY);
+        __m128 reach = _mm_add_ps(_mm_loadu_ps(r + i), probeR);
+        __m128 distanceSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        mask |= (uint32_t)_mm_movemask_ps(_mm_cmplt_ps(distanceSq, _mm_mul_ps(reach, reach))) << i;
+    }
+#elif defined(COLLIDER_NEON)
+    const float32x4_t probeX = vdupq_n_f32(px);
+    const float32x4_t probeY = vdupq_n_f32(py);
+    const float32x4_t probeR = vdupq_n_f32(pr);
+    const uint32_t laneBitsData[4] = {1, 2, 4, 8};
+    const uint32x4_t laneBits = vld1q_u32(laneBitsData);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t dx = vsubq_f32(vld1q_f32(x + i), probeX);
+        float32x4_t dy = vsubq_f32(vld1q_f32(y + i), probeY);
+        float32x4_t reach = vaddq_f32(vld1q_f32(r + i), probeR);
+        float32x4_t distanceSq = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+        uint32x4_t hit = vcltq_f32(distanceSq, vmulq_f32(reach, reach));
+        mask |= vaddvq_u32(vandq_u32(hit, laneBits)) << i;
+    }
+#endif
+
+    for (; i < count; i++) {
+        float dx = x[i] - px;
+        float dy = y[i] - py;
+        float reach = r[i] + pr;
+        if (dx * dx + dy * dy < reach * reach) {
+            mask |= 1u << i;
+        }
+    }
+
+    return mask;
+}
+
+} // namespace omegarace
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace omegarace {
+
+// Every collidable circle for one tick, stored as parallel arrays so overlap tests stream through
+// positions and radii without touching the entities. Filled once per tick, before any query.
+class ColliderTable {
+  public:
+    void clear();
+    // Returns the collider's id; ids count up from 0 in the order colliders were added
+    int add(float x, float y, float radius, uint8_t type, int owner);
+
+    int size() const { return (int)m_X.size(); }
+    float x(int id) const { return m_X[id]; }
+    float y(int id) const { return m_Y[id]; }
+    float radius(int id) const { return m_Radius[id]; }
+    uint8_t type(int id) const { return m_Type[id]; }
+    int owner(int id) const { return m_Owner[id]; } // ship number, or pool handle id for mines and rocks
+
+  private:
+    std::vector<float> m_X;
+    std::vector<float> m_Y;
+    std::vector<float> m_Radius;
+    std::vector<uint8_t> m_Type;
+    std::vector<int> m_Owner;
+};
+
+// Tests one probe circle against up to 32 circles held as parallel arrays. Bit i of the result is
+// set when circle i strictly overlaps the probe. Compares squared distances, using SSE2 or NEON
+// four lanes at a time where available.
+uint32_t CircleOverlapMask(float px, float py, float pr, const float* x, const float* y, const float* r, int count);
+
+} // namespace omegarace
@@ -1,4 +1,5 @@
 #include "Common.h"
+#include "Random.h"
 #include "Window.h"
 
 namespace omegarace {
@@ -10,15 +11,15 @@ Common::~Common() {
 }
 
 Vector2i Common::randomLocation() {
-    return Vector2i(Window::Random(0, Window::GetWindowSize().x), Window::Random(0, Window::GetWindowSize().y));
+    return Vector2i(Random::Int(Random::STREAM_WAVES, 0, Window::GetWindowSize().x), Random::Int(Random::STREAM_WAVES, 0, Window::GetWindowSize().y));
 }
 
 int Common::getRandomX() {
-    return (Window::Random(0, Window::GetWindowSize().x));
+    return (Random::Int(Random::STREAM_WAVES, 0, Window::GetWindowSize().x));
 }
 
 int Common::getRandomY() {
-    return (Window::Random(0, Window::GetWindowSize().y));
+    return (Random::Int(Random::STREAM_WAVES, 0, Window::GetWindowSize().y));
 }
 
 } // namespace omegarace
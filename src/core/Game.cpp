@@ -1,15 +1,38 @@
 #include "Game.h"
-#include "../input/InputManager.h"
+#include "Logger.h"
 #include <iostream>
 
 namespace omegarace {
 
-Game::Game() : running(false), m_AccumulatedTime(0.0), m_LastUpdateTime(0.0) {
+Game::Game()
+    : running(false), m_Headless(false), m_DumpDraws(false), m_FrameLimit(0), m_Pipelined(false),
+      m_FrameTimeTotal(0.0), m_FrameTimeCount(0), m_AccumulatedTime(0.0), m_LastUpdateTime(0.0) {
     // Game constructor
 }
 
 Game::~Game() {
     onCleanup();
+    pGameController.reset();
+    Platform::SetAudio(nullptr);
+    Platform::SetInput(nullptr);
+}
+
+void Game::setHeadlessRendering(bool dumpDraws, int frameLimit) {
+    m_Headless = true;
+    m_DumpDraws = dumpDraws;
+    m_FrameLimit = frameLimit;
+}
+
+void Game::setPipelinedRendering(bool pipelined) {
+    m_Pipelined = pipelined;
+}
+
+void Game::setInputRecording(const std::string& path) {
+    m_RecordPath = path;
+}
+
+void Game::setInputReplay(const std::string& path) {
+    m_ReplayPath = path;
 }
 
 int Game::onInit() {
@@ -17,17 +40,20 @@ int Game::onInit() {
     int screenHeight = 768;
 
     try {
-        Window::Init(screenWidth, screenHeight, "Omega Race");
+        Window::Init(screenWidth, screenHeight, "Omega Race", m_Headless);
     } catch (const std::runtime_error& error) {
         Window::logError(std::cout, "Window OnInit error: " + std::string(error.what()));
         Window::Quit();
         return APP_FAILED;
     }
 
+    Jobs::Init();
+
     return APP_OK;
 }
 
 void Game::onCleanup() {
+    Jobs::Shutdown();
 }
 
 int Game::OnExecute() {
@@ -35,51 +61,84 @@ int Game::OnExecute() {
         return -1;
     }
 
+    Platform::SetAudio(&m_AudioOutput);
+    Platform::SetInput(&m_InputSource);
     pGameController = std::make_unique<GameController>();
-    
-    pTimer = std::make_unique<Timer>();
-    pTimer->start();
+    if (!m_ReplayPath.empty() && !pGameController->startReplay(m_ReplayPath)) {
+        return -1;
+    }
+    if (!m_RecordPath.empty() && !pGameController->startRecording(m_RecordPath)) {
+        return -1;
+    }
+
+    m_StartTime = std::chrono::steady_clock::now();
     
     pGameController->initialize();
 
+    int frameCount = 0;
     running = true;
     while (running) {        // Process SDL events and update input state FIRST
+        auto frameStart = std::chrono::steady_clock::now();
         Window::BeginFrame();
 
+        // The simulation job has always finished by here, so the controller is this thread's until the
+        // next job starts
         handleInput(); // Process input every frame
 
         // Check for controller connections periodically
         InputManager::updateControllerDetection();
 
         // Check for fullscreen state changes (e.g., green button clicked)
-        if (Window::CheckForFullscreenToggle()) {
+        bool resized = Window::CheckForFullscreenToggle();
+        if (resized) {
             // Screen size changed - update UI components
             pGameController->onScreenSizeChanged();
         }
 
-        // Fixed timestep update at 60fps
-        double currentTime = pTimer->seconds();
-        double deltaTime = currentTime - m_LastUpdateTime;
-        m_LastUpdateTime = currentTime;
-
-        // Cap delta time to prevent spiral of death
-        if (deltaTime > 0.25)
-            deltaTime = 0.25;
+        if (m_Pipelined) {
+            // Tick N+1 simulates on a worker while tick N's snapshot is replayed and submitted here.
+            // Tick N's job was waited on last frame, so acquiring before the next one starts never skips
+            // a snapshot. A resize rebuilt the border buffers the last snapshot refers to, so that one is
+            // dropped; onScreenSizeChanged marks every retained layer dirty so the next one redraws them.
+            m_Snapshots.acquire();
+            m_SimulationDone.pending.store(1, std::memory_order_relaxed);
+            Jobs::Entry simulate = [](const void* game, int, int) {
+                static_cast<Game*>(const_cast<void*>(game))->simulateAndCapture();
+            };
+            Jobs::Submit({simulate, this, 0, 0, &m_SimulationDone});
+
+            if (!resized) {
+                Window::ReplaySnapshot(m_Snapshots.readBuffer());
+            }
+            Window::PresentFrame();
+            Jobs::Wait(m_SimulationDone);
+            InputManager::Update();
+        } else {
+            stepSimulation();
 
-        m_AccumulatedTime += deltaTime;
+            std::this_thread::yield();
 
-        // Update game logic at fixed 60fps intervals
-        while (m_AccumulatedTime >= TARGET_FRAME_TIME) {
-            if (!pTimer->paused()) {
-                pGameController->update(TARGET_FRAME_TIME);
-            }
-            m_AccumulatedTime -= TARGET_FRAME_TIME;
+            onRender();
+            Window::EndFrame();
         }
 
-        std::this_thread::yield();
+        if (m_DumpDraws) {
+            Window::DumpDrawRecords(std::cout);
+        }
+        if (m_FrameLimit > 0 && ++frameCount >= m_FrameLimit) {
+            running = false;
+        }
+        if (pGameController->isReplayFinished()) {
+            running = false;
+        }
 
-        onRender();
-        Window::EndFrame();
+        m_FrameTimeTotal += std::chrono::duration<double>(std::chrono::steady_clock::now() - frameStart).count();
+        if (++m_FrameTimeCount == FRAME_TIME_REPORT) {
+            Logger::Debug("Frame time: " + std::to_string(m_FrameTimeTotal * 1000.0 / m_FrameTimeCount) + " ms (" +
+                          (m_Pipelined ? "pipelined" : "serial") + ")");
+            m_FrameTimeTotal = 0.0;
+            m_FrameTimeCount = 0;
+        }
 
         std::this_thread::yield();
     }
@@ -94,11 +153,40 @@ void Game::onUpdate() {
     // Keeping this method for backwards compatibility or debugging purposes
 }
 
+void Game::stepSimulation() {
+    // Fixed timestep update at 60fps
+    double currentTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+    double deltaTime = currentTime - m_LastUpdateTime;
+    m_LastUpdateTime = currentTime;
+
+    // Cap delta time to prevent spiral of death
+    if (deltaTime > 0.25)
+        deltaTime = 0.25;
+
+    m_AccumulatedTime += deltaTime;
+
+    // Update game logic at fixed 60fps intervals
+    while (m_AccumulatedTime >= TARGET_FRAME_TIME) {
+        pGameController->update(TARGET_FRAME_TIME);
+        m_AccumulatedTime -= TARGET_FRAME_TIME;
+    }
+}
+
+void Game::simulateAndCapture() {
+    // Updates run inside the capture too, so a renderer call made from one lands in the snapshot
+    Window::BeginCapture(m_Snapshots.writeBuffer());
+    stepSimulation();
+    onRender();
+    Window::EndCapture();
+    m_Snapshots.publish();
+}
+
 void Game::onRender() {
     // Always draw neon grid background with electrical surge effect during warp
     float warpIntensity = pGameController->getWarpIntensity();
     
     // More subtle grid: thinner lines, dimmer colors, lower alpha
+    Window::SetDrawLayer(Window::DRAW_LAYER_GRID);
     if (pGameController->isPlayerActive()) {
         Vector2f playerPos = pGameController->getPlayerPosition();
         Window::DrawNeonGrid(32.0f, 0.025f, 1.0f, {0, 150, 200, 60}, &playerPos, warpIntensity);
@@ -107,11 +195,12 @@ void Game::onRender() {
         Window::DrawNeonGrid(32.0f, 0.025f, 1.0f, {0, 150, 200, 60}, nullptr, warpIntensity);
     }
     
+    Window::SetDrawLayer(Window::DRAW_LAYER_WORLD);
     pGameController->draw();
     
-    // Apply aggressive post-process bloom effect for enhanced Geometry Wars-style glow
-    // Lower threshold (0.1), much higher intensity (3.5), larger radius (0.05)
-    Window::ApplyPostProcessBloom(0.1f, 3.5f, 0.05f);
+    // Post-process bloom for the Geometry Wars-style glow
+    // Threshold (0.25) keeps the dim grid out, intensity (1.5) on the blurred highlights, radius in texels (1.0)
+    Window::ApplyPostProcessBloom(0.25f, 1.5f, 1.0f);
 }
 
 void Game::handleInput() {
@@ -1,8 +1,12 @@
 #pragma once
 
+#include "AudioEngine.h"
 #include "GameController.h"
-#include "Timer.h"
+#include "Jobs.h"
+#include "TripleBuffer.h"
+#include "../input/InputManager.h"
 #include "Window.h"
+#include <chrono>
 #include <thread>
 
 namespace omegarace {
@@ -17,14 +21,50 @@ class Game {
 
     int OnExecute();
 
+    // Render through bgfx's Noop renderer with no window, optionally dumping every frame's draw calls
+    // to stdout and stopping after frameLimit frames (0 runs until quit)
+    void setHeadlessRendering(bool dumpDraws, int frameLimit);
+
+    // Run the simulation for the next frame on a job worker while this thread replays the snapshot of
+    // the last one, instead of simulating then drawing in turn
+    void setPipelinedRendering(bool pipelined);
+
+    // Record this session's input to a replay file, or play one back instead of live input
+    void setInputRecording(const std::string& path);
+    void setInputReplay(const std::string& path);
+
   private:
-    std::unique_ptr<Timer> pTimer;
+    // Wall clock that paces the fixed-step loop; gameplay itself runs on SimClock
+    std::chrono::steady_clock::time_point m_StartTime;
+
+    // FMOD and SDL backends the simulation is bound to; declared first so they outlive the controller
+    FmodAudioOutput m_AudioOutput;
+    DeviceInputSource m_InputSource;
 
     std::unique_ptr<GameController> pGameController;
 
     // Whether the application is running.
     bool running;
 
+    // Headless rendering options
+    bool m_Headless;
+    bool m_DumpDraws;
+    int m_FrameLimit;
+
+    // Pipelined rendering: snapshots go from the simulation job to this thread through m_Snapshots
+    bool m_Pipelined;
+    TripleBuffer<Window::FrameSnapshot> m_Snapshots;
+    JobCounter m_SimulationDone;
+
+    // Frame time, averaged and logged every FRAME_TIME_REPORT frames so the two modes can be compared
+    static constexpr int FRAME_TIME_REPORT = 600;
+    double m_FrameTimeTotal;
+    int m_FrameTimeCount;
+
+    // Replay files (empty when unused)
+    std::string m_RecordPath;
+    std::string m_ReplayPath;
+
     // Ticks last cycle/frame
     int m_LastTickTime;
 
@@ -46,6 +86,12 @@ class Game {
     // Called to update game logic
     void onUpdate();
 
+    // Runs the fixed steps owed since the last call
+    void stepSimulation();
+
+    // Pipelined mode's job: step the simulation and capture the frame into m_Snapshots
+    void simulateAndCapture();
+
     // Called to render the app.
     void onRender();
 };
@@ -1,5 +1,10 @@
 #include "GameController.h"
-#include "../input/InputManager.h"
+#include "Logger.h"
+#include "ParticleSystem.h"
+#include "Platform.h"
+#include "Projectiles.h"
+#include "Random.h"
+#include "SimClock.h"
 #include <cmath>
 #include <ctime>
 
@@ -8,7 +13,11 @@ namespace omegarace {
 static StatusDisplay::GAME_STATE states[3] = {StatusDisplay::APP_START, StatusDisplay::APP_INSTRUCTIONS,
                                               StatusDisplay::APP_GAMEOVER};
 
-GameController::GameController() {
+GameController::GameController()
+    : m_CollisionGrid((float)Window::GetWindowSize().x, (float)Window::GetWindowSize().y, COLLISION_CELL_SIZE) {
+    // A controller is one run: its clock, and every Timer started from here on, begins at tick 0
+    SimClock::Reset();
+
     pThePlayer = std::make_unique<Player>();
 
     pTheBorders = std::make_unique<Borders>();
@@ -28,8 +37,9 @@ GameController::GameController() {
     pTimer->start();
     m_Respawn = false;
 
-    // Initialize random generator for Rock creation
-    m_RandomGenerator.seed(static_cast<unsigned int>(time(nullptr)));
+    // Seed every gameplay random source; a replay reseeds with the seed it was recorded under
+    m_InputTick = 0;
+    seedRandom(static_cast<uint32_t>(time(nullptr)));
 
     // Initialize bonus life system
     m_NextBonusLifeThreshold = 50000;
@@ -60,20 +70,14 @@ GameController::GameController() {
 }
 
 GameController::~GameController() {
-    // Clean up rocks
-    for (omegarace::Rock* rock : m_Rocks) {
-        delete rock;
-    }
-    m_Rocks.clear();
-
     // Clean up UFO
     delete m_UFO;
 
-    AudioEngine::Shutdown();
+    Platform::Audio().shutdown();
 }
 
 void GameController::initialize() {
-    AudioEngine::Init();
+    Platform::Audio().init();
 
     pTheBorders->initialize();
     pThePlayer->initialize();
@@ -85,32 +89,41 @@ void GameController::initialize() {
     pStatus->initialize();
     pPauseMenu->initialize();
 
-    AudioEngine::LoadBank("Master.bank", 0);
-    AudioEngine::LoadBank("Master.strings.bank", 0);
-    AudioEngine::PlayEvent("event:/Horizontal Crime Demo");
+    Platform::Audio().loadBank("Master.bank");
+    Platform::Audio().loadBank("Master.strings.bank");
+    Platform::Audio().playEvent("event:/Horizontal Crime Demo");
 
-    AudioEngine::LoadSound("EnemyHit");
-    AudioEngine::LoadSound("EnemyHit");
-    AudioEngine::LoadSound("LeadEnemyHit");
-    AudioEngine::LoadSound("FollowerHit");
-    AudioEngine::LoadSound("FighterHit");
-    AudioEngine::LoadSound("MineHit");
-    AudioEngine::LoadSound("PlayerHit");
+    Platform::Audio().loadSound("EnemyHit");
+    Platform::Audio().loadSound("EnemyHit");
+    Platform::Audio().loadSound("LeadEnemyHit");
+    Platform::Audio().loadSound("FollowerHit");
+    Platform::Audio().loadSound("FighterHit");
+    Platform::Audio().loadSound("MineHit");
+    Platform::Audio().loadSound("PlayerHit");
 
     // Initialize rock system (sound will be handled through FMOD like other sounds)
 }
 
 void GameController::update(double Frame) {
-    AudioEngine::Update();
+    Platform::Audio().update();
+
+    TickInput input = nextTickInput();
 
     // Handle pause input first (works even during other states)
-    handlePauseInput();
+    bool wasPaused = m_IsPaused;
+    applyPauseInput(input);
 
-    // Don't update gameplay if paused
+    // Don't update gameplay if paused; game time stands still with it
     if (m_IsPaused) {
         pPauseMenu->update();
         return;
     }
+    if (wasPaused) {
+        input.buttons &= ~TickInput::FIRE; // Space/Ctrl just picked a menu item; it is not a shot
+    }
+    SimClock::Advance(Frame);
+    applyGameInput(input);
+    updateWarpTransition();
 
     // Only update gameplay entities if not during warp transition
     if (!m_WarpActive) {
@@ -119,6 +132,8 @@ void GameController::update(double Frame) {
         pTheEnemyController->update(Frame);
         updateRocks(Frame); // Update rocks
         updateUFO(Frame);   // Update UFO
+        Projectiles::Update(Frame); // After everyone has fired, so new shots move this tick too
+        ParticleSystem::Update(Frame);
         pFighter->setPlayerLocation(pThePlayer->getLocation());
         pLeader->setPlayerLocation(pThePlayer->getLocation());
         pTheEnemyController->setPlayerPosition(pThePlayer->getLocation()); // For menacing FollowEnemy effects
@@ -213,40 +228,28 @@ void GameController::draw() {
         distortionSources.push_back(DistortionSource(fighterPos, 1.5f, 100.0f));
     }
 
-    // First 50% - still draw entities normally, but not during warp
+    // First 50% - still draw entities normally, but not during warp. Each group is recorded on its own
+    // worker when a pipelined frame is replayed.
     if (!m_WarpActive) {
+        Window::BeginDrawGroup();
         pThePlayer->draw();
         pTheEnemyController->draw();
+        Window::BeginDrawGroup();
+        Projectiles::Draw();
         drawRocks();
         drawUFO();
+        Window::BeginDrawGroup();
+        ParticleSystem::Draw();
     }
     
+    Window::BeginDrawGroup();
     pTheBorders->draw();
+
+    // Score, lives and menus stay on top of everything drawn above
+    Window::BeginDrawGroup();
+    Window::SetDrawLayer(Window::DRAW_LAYER_HUD);
     pStatus->draw();
 
-    // Draw full screen warp transition effect if active (only used for special transitions like new game)
-    if (m_WarpActive) {
-        float elapsedTime = pTimer->seconds() - m_WarpStartTime;
-        float warpProgress = elapsedTime / m_WarpDuration;
-
-        if (warpProgress <= 1.0f) {
-            // Create an intensity curve that's more visible throughout the transition
-            float intensity;
-            if (warpProgress < 0.5f) {
-                // Start at 0.5 minimum, peak at 1.0 at midpoint
-                intensity = 0.5f + (warpProgress * 1.0f); // Ramp from 0.5 to 1.0
-            } else {
-                // Ramp down from 1.0 to 0.5, not to 0
-                intensity = 0.5f + ((1.0f - warpProgress) * 1.0f); // Ramp from 1.0 to 0.5
-            }
-        } else {
-            m_WarpActive = false; // Effect finished
-            
-            // Reactivate player after warp transition ends
-            pThePlayer->setActive(true);
-        }
-    }
-    
     // Draw pause menu last (on top of everything)
     if (m_IsPaused) {
         pPauseMenu->draw();
@@ -258,9 +261,6 @@ void GameController::newGame() {
     m_WaitingForWarp = false;    // Reset wave waiting flag for new game
 
     // Clear existing rocks
-    for (omegarace::Rock* rock : m_Rocks) {
-        delete rock;
-    }
     m_Rocks.clear();
     m_CurrentWave = 1; // Reset wave counter
 
@@ -290,68 +290,48 @@ void GameController::newGame() {
     triggerWarpTransition(2.0f);
     m_WaitingForWarp = true;
     
-    AudioEngine::PlayEvent("event:/Horizontal Souls");
+    Platform::Audio().playEvent("event:/Horizontal Souls");
 }
 
 void GameController::handleInput() {
-    // Don't process game input if paused (except pause toggle which is handled in update)
-    if (m_IsPaused) {
-        return;
-    }
-    
-    // Block ALL input during warp transition
-    if (m_WarpActive) {
-        // Apply disabled input states during warp
-        pThePlayer->setTurnLeft(false);
-        pThePlayer->setTurnRight(false);
-        pThePlayer->setThrust(false);
-        return; // Exit early, no further input processing during warp
-    }
-    
-    // Combined keyboard and controller input handling
-    // Start with keyboard states
-    bool turnLeft = false;
-    bool turnRight = false;
-    bool thrust = false;
-
-    // New game controls - combined keyboard and controller (only when not in active gameplay)
-    bool newGamePressed = InputManager::IsKeyPressed(KEY_N) || 
-                         (InputManager::IsControllerConnected() && 
-                          InputManager::IsGamepadButtonPressed(0, GAMEPAD_BUTTON_MIDDLE_RIGHT)); // Options button
-    
-    if (newGamePressed) {
-        // Only allow new game when player is not active (game over, menu screens)
-        if (!pThePlayer->getActive()) {
-            newGame();
-        }
+    // Sample keyboard and controller into the input the next tick will act on. Held states follow
+    // the devices; presses accumulate until a tick consumes them, so none are lost on frames that
+    // run no update.
+    uint16_t buttons = m_PendingInput.buttons & ~TickInput::HELD;
+
+    // New game controls - combined keyboard and controller (only acted on when not in active gameplay)
+    if (Platform::Input().isKeyPressed(KEY_N) ||
+        (Platform::Input().isControllerConnected() &&
+         Platform::Input().isGamepadButtonPressed(0, GAMEPAD_BUTTON_MIDDLE_RIGHT))) { // Options button
+        buttons |= TickInput::NEW_GAME;
     }
 
     // === KEYBOARD INPUT ===
     // Turn left (A key or Left arrow)
-    if (InputManager::IsKeyDown(KEY_A) || InputManager::IsKeyDown(KEY_LEFT)) {
-        turnLeft = true;
+    if (Platform::Input().isKeyDown(KEY_A) || Platform::Input().isKeyDown(KEY_LEFT)) {
+        buttons |= TickInput::TURN_LEFT;
     }
 
     // Turn right (D key or Right arrow)
-    if (InputManager::IsKeyDown(KEY_D) || InputManager::IsKeyDown(KEY_RIGHT)) {
-        turnRight = true;
+    if (Platform::Input().isKeyDown(KEY_D) || Platform::Input().isKeyDown(KEY_RIGHT)) {
+        buttons |= TickInput::TURN_RIGHT;
     }
 
     // Thrust (W key or Up arrow)
-    if (InputManager::IsKeyDown(KEY_W) || InputManager::IsKeyDown(KEY_UP)) {
-        thrust = true;
+    if (Platform::Input().isKeyDown(KEY_W) || Platform::Input().isKeyDown(KEY_UP)) {
+        buttons |= TickInput::THRUST;
     }
 
     // Fire (S key, Space, or Left Ctrl) - use proper single shot detection
-    bool spacePressed = InputManager::IsKeyDown(KEY_SPACE);
-    bool sPressed = InputManager::IsKeyDown(KEY_S);
-    bool ctrlPressed = InputManager::IsKeyDown(KEY_LEFT_CONTROL);
+    bool spacePressed = Platform::Input().isKeyDown(KEY_SPACE);
+    bool sPressed = Platform::Input().isKeyDown(KEY_S);
+    bool ctrlPressed = Platform::Input().isKeyDown(KEY_LEFT_CONTROL);
     
     // Fire on key press (transition from not pressed to pressed)
     if ((spacePressed && !m_SpaceKeyWasPressed) ||
         (sPressed && !m_SKeyWasPressed) ||
         (ctrlPressed && !m_CtrlKeyWasPressed)) {
-        pThePlayer->fireButtonPressed();
+        buttons |= TickInput::FIRE;
     }
     
     // Update previous key states
@@ -361,457 +341,423 @@ void GameController::handleInput() {
 
     // === CONTROLLER INPUT (ADDITIVE) ===
     // PS4 Controller input handling with enhanced support
-    if (InputManager::IsControllerConnected()) {
-        int gamepadId = 0; // InputManager handles controller detection internally
-
-        // === GAME CONTROLS (work during warp) ===
-        // Note: Options button for new game is now handled in main controller logic with edge detection
+    if (Platform::Input().isControllerConnected()) {
+        int gamepadId = 0; // the input source handles controller detection
 
         // === TURNING CONTROLS ===
         // Method 1: Left analog stick (preferred for smooth control)
-        float leftStickX = InputManager::GetGamepadAxisMovement(gamepadId, GAMEPAD_AXIS_LEFT_X);
+        float leftStickX = Platform::Input().getGamepadAxisMovement(gamepadId, GAMEPAD_AXIS_LEFT_X);
         const float STICK_DEADZONE = 0.2f;
 
         // Analog stick turning (smooth)
         if (leftStickX < -STICK_DEADZONE) {
-            turnLeft = true; // Add to keyboard input
+            buttons |= TickInput::TURN_LEFT; // Add to keyboard input
         } else if (leftStickX > STICK_DEADZONE) {
-            turnRight = true; // Add to keyboard input
+            buttons |= TickInput::TURN_RIGHT; // Add to keyboard input
         }
 
         // Method 2: D-pad for precise turning (PS4 D-pad)
-        if (InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_LEFT_FACE_LEFT)) { // D-pad Left
-            turnLeft = true;                                                         // Add to keyboard input
+        if (Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_LEFT_FACE_LEFT)) { // D-pad Left
+            buttons |= TickInput::TURN_LEFT;
         }
-        if (InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_LEFT_FACE_RIGHT)) { // D-pad Right
-            turnRight = true;                                                         // Add to keyboard input
+        if (Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_LEFT_FACE_RIGHT)) { // D-pad Right
+            buttons |= TickInput::TURN_RIGHT;
         }
 
         // === THRUST CONTROLS ===
         // Method 1: R1 button - PRIMARY
-        if (InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_RIGHT_TRIGGER_1)) { // R1 button
-            thrust = true;                                                            // Add to keyboard input
+        if (Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_RIGHT_TRIGGER_1)) { // R1 button
+            buttons |= TickInput::THRUST;
         }
 
         // Method 2: Right analog stick up
-        float rightStickY = InputManager::GetGamepadAxisMovement(gamepadId, GAMEPAD_AXIS_RIGHT_Y);
+        float rightStickY = Platform::Input().getGamepadAxisMovement(gamepadId, GAMEPAD_AXIS_RIGHT_Y);
         if (rightStickY < -STICK_DEADZONE) { // Up on right stick
-            thrust = true;                   // Add to keyboard input
+            buttons |= TickInput::THRUST;
         }
 
         // === FIRE CONTROLS ===
         // Method 1: X button (PS4 X = bottom face button) - PRIMARY
-        if (InputManager::IsGamepadButtonPressed(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_DOWN)) { // X button
-            pThePlayer->fireButtonPressed();
-        }
-
         // Method 2: Square button (PS4 Square = left face button)
-        if (InputManager::IsGamepadButtonPressed(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_LEFT)) { // Square
-            pThePlayer->fireButtonPressed();
+        if (Platform::Input().isGamepadButtonPressed(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_DOWN) ||
+            Platform::Input().isGamepadButtonPressed(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_LEFT)) {
+            buttons |= TickInput::FIRE;
         }
 
         // Method 3: Circle button (PS4 Circle = right face button)
-        if (InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT)) { // Circle
-            thrust = true;                                                             // Add to keyboard input
+        if (Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT)) { // Circle
+            buttons |= TickInput::THRUST;
         }
 
-        // Triangle button for special actions
-        if (InputManager::IsGamepadButtonPressed(gamepadId, GAMEPAD_BUTTON_RIGHT_FACE_UP)) { // Triangle
-            // Reserved for future features
-        }
+        // Triangle button reserved for future features
     }
 
-    // Apply combined input states (keyboard OR controller)
-    pThePlayer->setTurnLeft(turnLeft);
-    pThePlayer->setTurnRight(turnRight);
-    pThePlayer->setThrust(thrust);
+    buttons |= samplePauseInput();
+    m_PendingInput.buttons = buttons;
 }
 
-void GameController::onPause(bool paused) {
-    if (paused) {
-        pTheEnemyController->timerUnpause();
-        pThePlayer->timerUnpause();
-    } else {
-        pTheEnemyController->timerPause();
-        pThePlayer->timerPause();
+TickInput GameController::nextTickInput() {
+    TickInput input = m_PendingInput;
+    m_PendingInput.buttons &= TickInput::HELD; // Presses belong to the tick that consumes them
+
+    if (m_ReplayReader) {
+        input = m_ReplayReader->next(m_InputTick);
+    } else if (m_ReplayWriter) {
+        m_ReplayWriter->record(m_InputTick, input);
     }
+    m_InputTick++;
+    return input;
 }
 
-void GameController::checkCollisions() {
-    for (int shot = 0; shot < pThePlayer->getNumberOfShots(); shot++) {
-        if (pThePlayer->getShotActive(shot)) {
-            if (doesPlayerShotEnemy(shot)) {
-                AudioEngine::PlaySoundFile("EnemyHit");
-                m_Score += 1000;
-                checkBonusLife();
-            }
-
-            if (doesPlayerShootLeadEnemy(shot)) {
-                AudioEngine::PlaySoundFile("LeadEnemyHit");
-                m_Score += 1500;
-                checkBonusLife();
-            }
-
-            if (doesPlayerShootFollowEnemy(shot)) {
-                AudioEngine::PlaySoundFile("FollowerHit");
-                m_Score += 1500;
-                checkBonusLife();
-            }
-
-            if (doesPlayerShootFighter(shot)) {
-                AudioEngine::PlaySoundFile("FighterHit");
-                m_Score += 2500;
-                checkBonusLife();
-            }
-
-            if (doesPlayerShootFollowMine(shot)) {
-                AudioEngine::PlaySoundFile("MineHit");
-                m_Score += 350;
-                checkBonusLife();
-            }
-
-            if (doesPlayerShootFighterMine(shot)) {
-                AudioEngine::PlaySoundFile("MineHit");
-                m_Score += 500;
-                checkBonusLife();
-            }
-
-            // Check rock shooting
-            if (doesPlayerShootRock(shot)) {
-                AudioEngine::PlaySoundFile("MineHit");
-                m_Score += 750;
-                checkBonusLife();
-            }
-
-            // Check UFO shooting
-            if (doesPlayerShootUFO(shot)) {
-                AudioEngine::PlaySoundFile("Bonus");
-                // Score is already added in doesPlayerShootUFO method
-            }
-        }
+void GameController::applyGameInput(const TickInput& input) {
+    // Block ALL input during warp transition
+    if (m_WarpActive) {
+        // Apply disabled input states during warp
+        pThePlayer->setTurnLeft(false);
+        pThePlayer->setTurnRight(false);
+        pThePlayer->setThrust(false);
+        return; // Exit early, no further input processing during warp
     }
 
-    // Only check player collisions if player is active and not already hit
-    if (pThePlayer->getActive() && !pThePlayer->getHit()) {
-        for (int ship = 0; ship < pTheEnemyController->getEnemyCount(); ship++) {
-            if (pTheEnemyController->getEnemyActive(ship)) {
-                if (doesEnemyCollideWithPlayer(ship)) {
-                    AudioEngine::PlaySoundFile("PlayerHit");
-                    if (playerHit()) {
-                        return; // Exit collision checking since player is respawning
-                    }
-                }
-            }
-        }
-
-        if (pLeader->getActive()) {
-            if (doesLeadCollideWithPlayer()) {
-                AudioEngine::PlaySoundFile("PlayerHit");
-                if (playerHit()) {
-                    return; // Exit collision checking since player is respawning
-                }
-            }
-        }
-
-        if (pFollower->getActive()) {
-            if (doesFollowCollideWithPlayer()) {
-                AudioEngine::PlaySoundFile("PlayerHit");
-                if (playerHit()) {
-                    return; // Exit collision checking since player is respawning
-                }
-            }
-        }
-
-        if (pFighter->getActive()) {
-            if (doesFighterCollideWithPlayer()) {
-                AudioEngine::PlaySoundFile("PlayerHit");
-                if (playerHit()) {
-                    return; // Exit collision checking since player is respawning
-                }
-            }
-        }
-
-        if (pFollower->getMineCount() > 0) {
-            for (int mine = 0; mine < pFollower->getMineCount(); mine++) {
-                if (pFollower->getMineActive(mine)) {
-                    if (doesFollowMineHitPalyer(mine)) {
-                        AudioEngine::PlaySoundFile("PlayerHit");
-                        if (playerHit()) {
-                            return; // Exit collision checking since player is respawning
-                        }
-                    }
-                }
-            }
-        }
-
-        if (pFighter->getMineCount() > 0) {
-            for (int mine = 0; mine < pFighter->getMineCount(); mine++) {
-                if (pFighter->getMineActive(mine)) {
-                    if (doesFighterMineHitPlayer(mine)) {
-                        AudioEngine::PlaySoundFile("PlayerHit");
-                        if (playerHit()) {
-                            return; // Exit collision checking since player is respawning
-                        }
-                    }
-                }
-            }
-        }
-
-        if (pLeader->getShotActive()) {
-            if (doesLeadShootPlayer()) {
-                AudioEngine::PlaySoundFile("PlayerHit");
-                if (playerHit()) {
-                    return; // Exit collision checking since player is respawning
-                }
-            }
-        }
-
-        if (pFighter->getShotActive()) {
-            if (doesFighterShootPlayer()) {
-                AudioEngine::PlaySoundFile("PlayerHit");
-                if (playerHit()) {
-                    return; // Exit collision checking since player is respawning
-                }
-            }
-        }
-
-        // Check rock collisions with player
-        for (int rock = 0; rock < (int)m_Rocks.size(); rock++) {
-            if (m_Rocks[rock] && !m_Rocks[rock]->isDestroyed()) {
-                if (doesRockCollideWithPlayer(rock)) {
-                    // Destroy the rock to prevent multiple hits
-                    m_Rocks[rock]->setDestroyed(true);
-                    m_Rocks[rock]->triggerDustExplosion();
-                    AudioEngine::PlaySoundFile("PlayerHit");
-                    if (playerHit()) {
-                        // Player was hit and still has lives remaining
-                        return; // Exit collision checking since player is respawning
-                    }
-                }
-            }
+    if (input.has(TickInput::NEW_GAME)) {
+        // Only allow new game when player is not active (game over, menu screens)
+        if (!pThePlayer->getActive()) {
+            newGame();
         }
+    }
 
-        // Check UFO collision with player
-        if (doesUFOCollideWithPlayer()) {
-            // Destroy the UFO to prevent multiple hits
-            m_UFO->triggerExplosion();
-            AudioEngine::PlaySoundFile("PlayerHit");
-            if (playerHit()) {
-                // Player was hit and still has lives remaining
-                return; // Exit collision checking since player is respawning
-            }
-        }
+    if (input.has(TickInput::FIRE)) {
+        pThePlayer->fireButtonPressed();
     }
-}
 
-void GameController::checkBonusLife() {
-    // Check if player has reached the next bonus life threshold
-    if (m_Score >= m_NextBonusLifeThreshold) {
-        // Award bonus life
-        m_PlayerShips++;
-        pStatus->setShip(m_PlayerShips);
+    // Apply combined input states (keyboard OR controller)
+    pThePlayer->setTurnLeft(input.has(TickInput::TURN_LEFT));
+    pThePlayer->setTurnRight(input.has(TickInput::TURN_RIGHT));
+    pThePlayer->setThrust(input.has(TickInput::THRUST));
+}
 
-        // Play bonus life sound (same as UFO bonus sound for now)
-        AudioEngine::PlaySoundFile("Bonus");
+void GameController::seedRandom(uint32_t seed) {
+    m_Seed = seed;
+    Random::Seed(seed);
+}
 
-        // Set next bonus life threshold (every 50,000 points)
-        m_NextBonusLifeThreshold += 50000;
+bool GameController::startRecording(const std::string& path) {
+    m_ReplayWriter = std::make_unique<ReplayWriter>();
+    if (!m_ReplayWriter->open(path, m_Seed)) {
+        m_ReplayWriter.reset();
+        return false;
     }
+    Logger::Info("Recording input to " + path);
+    return true;
 }
 
-bool GameController::doesPlayerShotEnemy(int shot) {
-    for (int ship = 0; ship < pTheEnemyController->getEnemyCount(); ship++) {
-        if (pTheEnemyController->getEnemyActive(ship)) {
-            // Get radius because it wont work inside of other function for unknown reason.
-            float radius = pTheEnemyController->getEnemyRadius();
-
-            if (pThePlayer->getShotCircle(pTheEnemyController->getEnemyLocaiton(ship), radius, shot)) {
-                pTheEnemyController->enemyHit(ship);
-                pThePlayer->setShotActive(shot, false);
-                return true;
-            }
-        }
+bool GameController::startReplay(const std::string& path) {
+    m_ReplayReader = std::make_unique<ReplayReader>();
+    if (!m_ReplayReader->open(path)) {
+        m_ReplayReader.reset();
+        return false;
     }
-
-    return false;
+    seedRandom(m_ReplayReader->seed());
+    Logger::Info("Replaying input from " + path);
+    return true;
 }
 
-bool GameController::doesPlayerShootLeadEnemy(int shot) {
-    if (pLeader->getActive()) {
-        float radius = pLeader->getRadius();
-
-        if (pThePlayer->getShotCircle(pLeader->getLocation(), radius, shot)) {
-            pTheEnemyController->leadEnemyHit();
-            pThePlayer->setShotActive(shot, false);
+bool GameController::isReplayFinished() const {
+    return m_ReplayReader && m_ReplayReader->finished(m_InputTick);
+}
 
-            if (pTheEnemyController->checkEndOfWave()) {
-                m_EndOfWave = true;
-            }
+void GameController::fillColliders() {
+    m_Colliders.clear();
 
-            return true;
-        }
+    // Add order is resolution order: when one probe overlaps several colliders, the earlier kinds
+    // and earlier entries react first
+    for (int live = 0; live < pTheEnemyController->getEnemyCount(); live++) {
+        int ship = pTheEnemyController->getLiveEnemy(live);
+        addCollider(pTheEnemyController->getEnemyLocaiton(ship), pTheEnemyController->getEnemyRadius(),
+                    COLLIDER_ENEMY, ship);
+    }
+    if (pLeader->getActive()) {
+        addCollider(pLeader->getLocation(), pLeader->getRadius(), COLLIDER_LEAD, 0);
     }
-
-    return false;
-}
-
-bool GameController::doesPlayerShootFollowEnemy(int shot) {
     if (pFollower->getActive()) {
-        float radius = pFollower->getRadius();
-
-        if (pThePlayer->getShotCircle(pFollower->getLocation(), radius, shot)) {
-            pTheEnemyController->followEnemyHit();
-            pThePlayer->setShotActive(shot, false);
-            return true;
-        }
+        addCollider(pFollower->getLocation(), pFollower->getRadius(), COLLIDER_FOLLOWER, 0);
     }
-
-    return false;
-}
-
-bool GameController::doesPlayerShootFighter(int shot) {
     if (pFighter->getActive()) {
-        float radius = pFighter->getRadius();
-
-        if (pThePlayer->getShotCircle(pFighter->getLocation(), radius, shot)) {
-            pFighter->explode();
-            pThePlayer->setShotActive(shot, false);
-
-            if (pTheEnemyController->checkEndOfWave()) {
-                m_EndOfWave = true;
-            }
-
-            return true;
+        addCollider(pFighter->getLocation(), pFighter->getRadius(), COLLIDER_FIGHTER, 0);
+    }
+    // Pooled colliders are owned by handle id, so a released slot can't be mistaken for its next user
+    for (int live = 0; live < pFollower->getMineCount(); live++) {
+        PoolHandle mine = pFollower->getMineHandle(live);
+        if (pFollower->getMineActive(mine)) {
+            addCollider(pFollower->getMineLocaiton(mine), pFollower->getMineRadius(mine), COLLIDER_FOLLOW_MINE,
+                        mine.id());
         }
     }
-
-    return false;
-}
-
-bool GameController::doesPlayerShootFollowMine(int shot) {
-    if (pFollower->getMineCount() > 0) {
-        float mineRadius = pFollower->getMineRadius();
-
-        for (int mine = 0; mine < pFollower->getMineCount(); mine++) {
-            if (pFollower->getMineActive(mine)) {
-                if (pThePlayer->getShotCircle(pFollower->getMineLocaiton(mine), mineRadius, shot)) {
-                    pFollower->mineHit(mine);
-                    pThePlayer->setShotActive(shot, false);
-                    return true;
-                }
-            }
+    for (int live = 0; live < pFighter->getMineCount(); live++) {
+        PoolHandle mine = pFighter->getMineHandle(live);
+        if (pFighter->getMineActive(mine)) {
+            addCollider(pFighter->getMineLocaiton(mine), pFighter->getMineRadius(mine), COLLIDER_FIGHTER_MINE,
+                        mine.id());
         }
     }
-
-    return false;
-}
-
-bool GameController::doesPlayerShootFighterMine(int shot) {
-    int mineCount = pFighter->getMineCount();
-
-    if (mineCount > 0) {
-        float mineRadius = pFighter->getMineRadius();
-
-        for (int mine = 0; mine < mineCount; mine++) {
-            if (pFighter->getMineActive(mine)) {
-                if (pThePlayer->getShotCircle(pFighter->getMineLocaiton(mine), mineRadius, shot)) {
-                    pFighter->mineHit(mine);
-                    pThePlayer->setShotActive(shot, false);
-                    return true;
-                }
-            }
+    if (pLeader->getShotActive()) {
+        addCollider(pLeader->getShotLocation(), pLeader->getShotRadius(), COLLIDER_LEAD_SHOT, 0);
+    }
+    if (pFighter->getShotActive()) {
+        addCollider(pFighter->getShotLocation(), pFighter->getShotRadius(), COLLIDER_FIGHTER_SHOT, 0);
+    }
+    for (int live = 0; live < m_Rocks.size(); live++) {
+        int slot = m_Rocks.liveSlot(live);
+        Rock* rock = m_Rocks.at(slot);
+        if (rock->active && !rock->destroyed) {
+            addCollider(rock->position, ROCK_COLLISION_RADIUS, COLLIDER_ROCK, m_Rocks.handleAt(slot).id());
         }
     }
-
-    return false;
-}
-
-bool GameController::doesEnemyCollideWithPlayer(int ship) {
-    float radius = pTheEnemyController->getEnemyRadius();
-
-    if (pThePlayer->circlesIntersect(pTheEnemyController->getEnemyLocaiton(ship), radius)) {
-        pTheEnemyController->enemyHit(ship);
-        return true;
+    if (m_UFO && m_UFO->isActive() && !m_UFO->isDestroyed()) {
+        addCollider(m_UFO->getLocation(), m_UFO->getRadius(), COLLIDER_UFO, 0);
     }
 
-    return false;
+    m_CollisionGrid.build(m_Colliders);
 }
 
-bool GameController::doesLeadCollideWithPlayer() {
-    float radius = pLeader->getRadius();
-
-    if (pThePlayer->circlesIntersect(pLeader->getLocation(), radius)) {
-        pTheEnemyController->leadEnemyHit();
-        return true;
-    }
-
-    return false;
+void GameController::addCollider(const Vector2f& location, float radius, ColliderType type, int owner) {
+    m_Colliders.add(location.x, location.y, radius, (uint8_t)type, owner);
 }
 
-bool GameController::doesFollowCollideWithPlayer() {
-    float radius = pFollower->getRadius();
-
-    if (pThePlayer->circlesIntersect(pFollower->getLocation(), radius)) {
-        pTheEnemyController->followEnemyHit();
-        return true;
+// Collision responses, resolved through a table built at compile time. Each rule names a pair of
+// collider kinds, the points and sound the pair is worth, and what happens to each side; the
+// collision pass only finds overlapping pairs and looks their rule up.
+struct CollisionRules {
+    using Kind = GameController::ColliderType;
+    using Reaction = void (*)(GameController& game, int owner);
+    using Liveness = bool (*)(GameController& game, int owner);
+
+    enum Sound : uint8_t {
+        SOUND_NONE,
+        SOUND_ENEMY_HIT,
+        SOUND_LEAD_ENEMY_HIT,
+        SOUND_FOLLOWER_HIT,
+        SOUND_FIGHTER_HIT,
+        SOUND_MINE_HIT,
+        SOUND_PLAYER_HIT,
+        SOUND_BONUS,
+        SOUND_COUNT
+    };
+
+    struct Response {
+        bool collides;
+        bool hitsPlayer; // the pair costs the player a life
+        int score;
+        Sound sound;
+        Reaction onFirst;
+        Reaction onSecond;
+    };
+
+    static constexpr int KINDS = GameController::COLLIDER_KIND_COUNT;
+    struct Matrix {
+        Response cell[KINDS][KINDS];
+        Liveness active[KINDS];
+    };
+
+    // Reactions: one side of a pair
+    static void none(GameController&, int) {}
+    static void spendShot(GameController&, int shot) { Projectiles::Retire(PoolHandle::FromId(shot)); }
+    static void destroyEnemy(GameController& game, int ship) { game.pTheEnemyController->enemyHit(ship); }
+    static void ramLead(GameController& game, int) { game.pTheEnemyController->leadEnemyHit(); }
+    static void shootLead(GameController& game, int) {
+        game.pTheEnemyController->leadEnemyHit();
+        if (game.pTheEnemyController->checkEndOfWave()) {
+            game.m_EndOfWave = true;
+        }
     }
-
-    return false;
-}
-
-bool GameController::doesFighterCollideWithPlayer() {
-    float radius = pFighter->getRadius();
-
-    if (pThePlayer->circlesIntersect(pFighter->getLocation(), radius)) {
-        pFighter->explode();
-        return true;
+    static void destroyFollower(GameController& game, int) { game.pTheEnemyController->followEnemyHit(); }
+    static void ramFighter(GameController& game, int) { game.pFighter->explode(); }
+    static void shootFighter(GameController& game, int) {
+        game.pFighter->explode();
+        if (game.pTheEnemyController->checkEndOfWave()) {
+            game.m_EndOfWave = true;
+        }
     }
+    static void destroyFollowMine(GameController& game, int mine) { game.pFollower->mineHit(PoolHandle::FromId(mine)); }
+    static void destroyFighterMine(GameController& game, int mine) { game.pFighter->mineHit(PoolHandle::FromId(mine)); }
+    static void spendLeadShot(GameController& game, int) { game.pLeader->shotHitTarget(); }
+    static void spendFighterShot(GameController& game, int) { game.pFighter->shotHitTarget(); }
+    static void destroyRock(GameController& game, int rock) {
+        // Rock is destroyed - use proper method to synchronize all variables
+        Rock* pRock = game.m_Rocks.get(PoolHandle::FromId(rock));
+        pRock->setDestroyed(true);
+        pRock->triggerDustExplosion();
+    }
+    static void ramUFO(GameController& game, int) { game.m_UFO->triggerExplosion(); }
+    static void shootUFO(GameController& game, int) {
+        // UFO is destroyed - trigger spectacular explosion
+        game.m_UFO->setDestroyed(true);
+        game.m_UFO->setActive(false);
+        game.m_UFO->triggerExplosion();
+    }
+
+    // Liveness: the table is a snapshot from the start of the pass, and an earlier hit may have
+    // retired a collider since
+    static bool always(GameController&, int) { return true; }
+    static bool enemyActive(GameController& game, int ship) { return game.pTheEnemyController->getEnemyActive(ship); }
+    static bool leadActive(GameController& game, int) { return game.pLeader->getActive(); }
+    static bool followerActive(GameController& game, int) { return game.pFollower->getActive(); }
+    static bool fighterActive(GameController& game, int) { return game.pFighter->getActive(); }
+    static bool followMineActive(GameController& game, int mine) {
+        return game.pFollower->getMineActive(PoolHandle::FromId(mine));
+    }
+    static bool fighterMineActive(GameController& game, int mine) {
+        return game.pFighter->getMineActive(PoolHandle::FromId(mine));
+    }
+    static bool leadShotActive(GameController& game, int) { return game.pLeader->getShotActive(); }
+    static bool fighterShotActive(GameController& game, int) { return game.pFighter->getShotActive(); }
+    static bool rockActive(GameController& game, int rock) {
+        Rock* pRock = game.m_Rocks.get(PoolHandle::FromId(rock));
+        return pRock && pRock->active && !pRock->destroyed;
+    }
+    static bool ufoActive(GameController& game, int) {
+        return game.m_UFO && game.m_UFO->isActive() && !game.m_UFO->isDestroyed();
+    }
+
+    // Registers a rule for both orderings of the pair
+    static constexpr void rule(Matrix& matrix, Kind first, Kind second, int score, Sound sound, Reaction onFirst,
+                               Reaction onSecond, bool hitsPlayer = false) {
+        matrix.cell[first][second] = {true, hitsPlayer, score, sound, onFirst, onSecond};
+        matrix.cell[second][first] = {true, hitsPlayer, score, sound, onSecond, onFirst};
+    }
+
+    static constexpr Matrix build() {
+        Matrix m{};
+        for (auto& row : m.cell) {
+            for (Response& response : row) {
+                response = {false, false, 0, SOUND_NONE, none, none};
+            }
+        }
 
-    return false;
-}
-
-bool GameController::doesFollowMineHitPalyer(int mine) {
-    float radius = pFollower->getMineRadius();
-
-    if (pThePlayer->circlesIntersect(pFollower->getMineLocaiton(mine), radius)) {
-        pFollower->mineHit(mine);
-        return true;
+        using GC = GameController;
+        const Kind SHOT = GC::COLLIDER_PLAYER_SHOT;
+        rule(m, SHOT, GC::COLLIDER_ENEMY, 1000, SOUND_ENEMY_HIT, spendShot, destroyEnemy);
+        rule(m, SHOT, GC::COLLIDER_LEAD, 1500, SOUND_LEAD_ENEMY_HIT, spendShot, shootLead);
+        rule(m, SHOT, GC::COLLIDER_FOLLOWER, 1500, SOUND_FOLLOWER_HIT, spendShot, destroyFollower);
+        rule(m, SHOT, GC::COLLIDER_FIGHTER, 2500, SOUND_FIGHTER_HIT, spendShot, shootFighter);
+        rule(m, SHOT, GC::COLLIDER_FOLLOW_MINE, 350, SOUND_MINE_HIT, spendShot, destroyFollowMine);
+        rule(m, SHOT, GC::COLLIDER_FIGHTER_MINE, 500, SOUND_MINE_HIT, spendShot, destroyFighterMine);
+        // Rocks and the UFO don't stop the shot
+        rule(m, SHOT, GC::COLLIDER_ROCK, 750, SOUND_MINE_HIT, none, destroyRock);
+        rule(m, SHOT, GC::COLLIDER_UFO, 1500, SOUND_BONUS, none, shootUFO);
+
+        const Kind PLAYER = GC::COLLIDER_PLAYER;
+        rule(m, PLAYER, GC::COLLIDER_ENEMY, 0, SOUND_PLAYER_HIT, none, destroyEnemy, true);
+        rule(m, PLAYER, GC::COLLIDER_LEAD, 0, SOUND_PLAYER_HIT, none, ramLead, true);
+        rule(m, PLAYER, GC::COLLIDER_FOLLOWER, 0, SOUND_PLAYER_HIT, none, destroyFollower, true);
+        rule(m, PLAYER, GC::COLLIDER_FIGHTER, 0, SOUND_PLAYER_HIT, none, ramFighter, true);
+        rule(m, PLAYER, GC::COLLIDER_FOLLOW_MINE, 0, SOUND_PLAYER_HIT, none, destroyFollowMine, true);
+        rule(m, PLAYER, GC::COLLIDER_FIGHTER_MINE, 0, SOUND_PLAYER_HIT, none, destroyFighterMine, true);
+        rule(m, PLAYER, GC::COLLIDER_LEAD_SHOT, 0, SOUND_PLAYER_HIT, none, spendLeadShot, true);
+        rule(m, PLAYER, GC::COLLIDER_FIGHTER_SHOT, 0, SOUND_PLAYER_HIT, none, spendFighterShot, true);
+        // Destroy the rock or UFO so it can't hit again
+        rule(m, PLAYER, GC::COLLIDER_ROCK, 0, SOUND_PLAYER_HIT, none, destroyRock, true);
+        rule(m, PLAYER, GC::COLLIDER_UFO, 0, SOUND_PLAYER_HIT, none, ramUFO, true);
+
+        for (Liveness& active : m.active) {
+            active = always;
+        }
+        m.active[GC::COLLIDER_ENEMY] = enemyActive;
+        m.active[GC::COLLIDER_LEAD] = leadActive;
+        m.active[GC::COLLIDER_FOLLOWER] = followerActive;
+        m.active[GC::COLLIDER_FIGHTER] = fighterActive;
+        m.active[GC::COLLIDER_FOLLOW_MINE] = followMineActive;
+        m.active[GC::COLLIDER_FIGHTER_MINE] = fighterMineActive;
+        m.active[GC::COLLIDER_LEAD_SHOT] = leadShotActive;
+        m.active[GC::COLLIDER_FIGHTER_SHOT] = fighterShotActive;
+        m.active[GC::COLLIDER_ROCK] = rockActive;
+        m.active[GC::COLLIDER_UFO] = ufoActive;
+        return m;
+    }
+
+    static const Matrix MATRIX;
+    static const std::string SOUND_NAMES[SOUND_COUNT];
+};
+
+constexpr CollisionRules::Matrix CollisionRules::MATRIX = CollisionRules::build();
+
+const std::string CollisionRules::SOUND_NAMES[SOUND_COUNT] = {
+    "", "EnemyHit", "LeadEnemyHit", "FollowerHit", "FighterHit", "MineHit", "PlayerHit", "Bonus"};
+
+bool GameController::resolveCollision(int first, int second) {
+    ColliderType firstKind = (ColliderType)m_Colliders.type(first);
+    ColliderType secondKind = (ColliderType)m_Colliders.type(second);
+    int firstOwner = m_Colliders.owner(first);
+    int secondOwner = m_Colliders.owner(second);
+
+    const CollisionRules::Response& response = CollisionRules::MATRIX.cell[firstKind][secondKind];
+    if (!response.collides || !CollisionRules::MATRIX.active[secondKind](*this, secondOwner)) {
+        return false;
     }
 
-    return false;
-}
-
-bool GameController::doesFighterMineHitPlayer(int mine) {
-    float radius = pFighter->getMineRadius();
-
-    if (pThePlayer->circlesIntersect(pFighter->getMineLocaiton(mine), radius)) {
-        pFighter->mineHit(mine);
-        return true;
+    response.onFirst(*this, firstOwner);
+    response.onSecond(*this, secondOwner);
+    if (response.sound != CollisionRules::SOUND_NONE) {
+        Platform::Audio().playSound(CollisionRules::SOUND_NAMES[response.sound]);
     }
-
-    return false;
+    if (response.score > 0) {
+        m_Score += response.score;
+        checkBonusLife();
+    }
+    return true;
 }
 
-bool GameController::doesLeadShootPlayer() {
-    float radius = pLeader->getShotRadius();
+void GameController::checkCollisions() {
+    fillColliders();
+
+    for (int slot = 0; slot < Projectiles::SlotCount(); slot++) {
+        PoolHandle shot = Projectiles::HandleAt(slot);
+        if (Projectiles::Active(shot) && Projectiles::OwnerAt(slot) == Projectiles::OWNER_PLAYER) {
+            Vector2f location = Projectiles::Location(shot);
+            int probe = m_Colliders.add(location.x, location.y, Projectiles::RADIUS, COLLIDER_PLAYER_SHOT, shot.id());
+            m_CollisionGrid.query(location.x, location.y, Projectiles::RADIUS, m_CollisionHits);
+
+            // A shot scores at most one collider of each kind per tick
+            unsigned kindsHit = 0;
+            for (int id : m_CollisionHits) {
+                unsigned kindBit = 1u << m_Colliders.type(id);
+                if ((kindsHit & kindBit) == 0 && resolveCollision(probe, id)) {
+                    kindsHit |= kindBit;
+                }
+            }
+        }
+    }
 
-    if (pThePlayer->circlesIntersect(pLeader->getShotLocation(), radius)) {
-        pLeader->shotHitTarget();
-        return true;
+    // Only check player collisions if player is active and not already hit
+    if (!pThePlayer->getActive() || pThePlayer->getHit()) {
+        return;
     }
 
-    return false;
+    Vector2f location = pThePlayer->getLocation();
+    int probe = m_Colliders.add(location.x, location.y, pThePlayer->getRadius(), COLLIDER_PLAYER, 0);
+    m_CollisionGrid.query(location.x, location.y, pThePlayer->getRadius(), m_CollisionHits);
+    for (int id : m_CollisionHits) {
+        if (resolveCollision(probe, id) && CollisionRules::MATRIX.cell[COLLIDER_PLAYER][m_Colliders.type(id)].hitsPlayer) {
+            if (playerHit()) {
+                return; // Exit collision checking since player is respawning
+            }
+        }
+    }
 }
 
-bool GameController::doesFighterShootPlayer() {
-    float radius = pFighter->getShotRadius();
+void GameController::checkBonusLife() {
+    // Check if player has reached the next bonus life threshold
+    if (m_Score >= m_NextBonusLifeThreshold) {
+        // Award bonus life
+        m_PlayerShips++;
+        pStatus->setShip(m_PlayerShips);
+
+        // Play bonus life sound (same as UFO bonus sound for now)
+        Platform::Audio().playSound("Bonus");
 
-    if (pThePlayer->circlesIntersect(pFighter->getShotLocation(), radius)) {
-        pFighter->shotHitTarget();
-        return true;
+        // Set next bonus life threshold (every 50,000 points)
+        m_NextBonusLifeThreshold += 50000;
     }
-
-    return false;
 }
 
 void GameController::spawnNewWave(int ships) {
@@ -820,7 +766,7 @@ void GameController::spawnNewWave(int ships) {
 
     bool rightSide;
 
-    if (Window::Random(0, 1))
+    if (Random::Int(Random::STREAM_WAVES, 0, 1))
         rightSide = true;
     else
         rightSide = false;
@@ -858,6 +804,16 @@ bool GameController::playerHit() {
     return false;
 }
 
+void GameController::updateWarpTransition() {
+    // Ended here rather than when drawn, so the tick it ends on depends only on game time
+    if (m_WarpActive && pTimer->seconds() - m_WarpStartTime > m_WarpDuration) {
+        m_WarpActive = false;
+
+        // Reactivate player after warp transition ends
+        pThePlayer->setActive(true);
+    }
+}
+
 void GameController::triggerWarpTransition(float duration) {
     m_WarpActive = true;
     m_WarpDuration = duration;
@@ -897,7 +853,10 @@ void GameController::spawnRocks(int waveNumber) {
     float safeZoneRadius = 120.0f; // Safe distance from player spawn points
 
     for (int i = 0; i < numRocks; i++) {
-        omegarace::Rock* pRock = new omegarace::Rock(m_RandomGenerator);
+        omegarace::Rock* pRock = m_Rocks.get(m_Rocks.acquire());
+        if (!pRock) {
+            return; // Every rock slot is still out
+        }
 
         // Try to find a safe spawn position
         omegarace::Vector2f spawnLocation;
@@ -907,32 +866,32 @@ void GameController::spawnRocks(int waveNumber) {
         const int maxAttempts = 10;
 
         while (!foundSafePosition && attempts < maxAttempts) {
-            int edge = rand() % 4; // 0: top, 1: right, 2: bottom, 3: left
+            int edge = Random::Int(Random::STREAM_ROCKS, 0, 3); // 0: top, 1: right, 2: bottom, 3: left
 
             switch (edge) {
                 case 0: // Top edge
-                    spawnLocation.x = (float)(rand() % 1024);
+                    spawnLocation.x = (float)Random::Int(Random::STREAM_ROCKS, 0, 1023);
                     spawnLocation.y = 50.0f;
-                    spawnVelocity.x = (float)((rand() % 20) - 10); // -10 to 10
-                    spawnVelocity.y = (float)(rand() % 10 + 5);    // 5 to 15
+                    spawnVelocity.x = (float)(Random::Int(Random::STREAM_ROCKS, 0, 19) - 10); // -10 to 10
+                    spawnVelocity.y = (float)(Random::Int(Random::STREAM_ROCKS, 0, 9) + 5);    // 5 to 15
                     break;
                 case 1: // Right edge
                     spawnLocation.x = 974.0f;
-                    spawnLocation.y = (float)(rand() % 768);
-                    spawnVelocity.x = -(float)(rand() % 10 + 5);   // -15 to -5
-                    spawnVelocity.y = (float)((rand() % 20) - 10); // -10 to 10
+                    spawnLocation.y = (float)Random::Int(Random::STREAM_ROCKS, 0, 767);
+                    spawnVelocity.x = -(float)(Random::Int(Random::STREAM_ROCKS, 0, 9) + 5);   // -15 to -5
+                    spawnVelocity.y = (float)(Random::Int(Random::STREAM_ROCKS, 0, 19) - 10); // -10 to 10
                     break;
                 case 2: // Bottom edge
-                    spawnLocation.x = (float)(rand() % 1024);
+                    spawnLocation.x = (float)Random::Int(Random::STREAM_ROCKS, 0, 1023);
                     spawnLocation.y = 718.0f;
-                    spawnVelocity.x = (float)((rand() % 20) - 10); // -10 to 10
-                    spawnVelocity.y = -(float)(rand() % 10 + 5);   // -15 to -5
+                    spawnVelocity.x = (float)(Random::Int(Random::STREAM_ROCKS, 0, 19) - 10); // -10 to 10
+                    spawnVelocity.y = -(float)(Random::Int(Random::STREAM_ROCKS, 0, 9) + 5);   // -15 to -5
                     break;
                 case 3: // Left edge
                     spawnLocation.x = 50.0f;
-                    spawnLocation.y = (float)(rand() % 768);
-                    spawnVelocity.x = (float)(rand() % 10 + 5);    // 5 to 15
-                    spawnVelocity.y = (float)((rand() % 20) - 10); // -10 to 10
+                    spawnLocation.y = (float)Random::Int(Random::STREAM_ROCKS, 0, 767);
+                    spawnVelocity.x = (float)(Random::Int(Random::STREAM_ROCKS, 0, 9) + 5);    // 5 to 15
+                    spawnVelocity.y = (float)(Random::Int(Random::STREAM_ROCKS, 0, 19) - 10); // -10 to 10
                     break;
             }
 
@@ -953,83 +912,40 @@ void GameController::spawnRocks(int waveNumber) {
             if (i % 2 == 0) {
                 spawnLocation.x = 512.0f; // Center X
                 spawnLocation.y = 150.0f; // Upper center
-                spawnVelocity.x = (float)((rand() % 20) - 10);
-                spawnVelocity.y = (float)(rand() % 10 + 5);
+                spawnVelocity.x = (float)(Random::Int(Random::STREAM_ROCKS, 0, 19) - 10);
+                spawnVelocity.y = (float)(Random::Int(Random::STREAM_ROCKS, 0, 9) + 5);
             } else {
                 spawnLocation.x = 512.0f; // Center X
                 spawnLocation.y = 618.0f; // Lower center
-                spawnVelocity.x = (float)((rand() % 20) - 10);
-                spawnVelocity.y = -(float)(rand() % 10 + 5);
+                spawnVelocity.x = (float)(Random::Int(Random::STREAM_ROCKS, 0, 19) - 10);
+                spawnVelocity.y = -(float)(Random::Int(Random::STREAM_ROCKS, 0, 9) + 5);
             }
         }
 
         pRock->activate(spawnLocation, spawnVelocity);
-        m_Rocks.push_back(pRock);
     }
 }
 
 void GameController::updateRocks(double frame) {
-    for (int i = (int)m_Rocks.size() - 1; i >= 0; i--) {
-        if (m_Rocks[i]) {
-            m_Rocks[i]->update(frame);
-
-            // Remove destroyed rocks
-            if (m_Rocks[i]->isDestroyed() && !m_Rocks[i]->isDustActive()) {
-                delete m_Rocks[i];
-                m_Rocks.erase(m_Rocks.begin() + i);
-            }
+    for (int live = m_Rocks.size() - 1; live >= 0; live--) {
+        int slot = m_Rocks.liveSlot(live);
+        Rock* rock = m_Rocks.at(slot);
+        rock->update(frame);
+
+        // Free destroyed rocks' slots; their dust lives on in the particle system
+        if (rock->isDestroyed()) {
+            m_Rocks.release(m_Rocks.handleAt(slot));
         }
     }
 }
 
 void GameController::drawRocks() {
-    for (size_t i = 0; i < m_Rocks.size(); i++) {
-        if (m_Rocks[i]) {
-            // Always draw rocks that are active OR have active dust explosions
-            if (!m_Rocks[i]->isDestroyed() || m_Rocks[i]->isDustActive()) {
-                m_Rocks[i]->draw();
-            }
-        }
-    }
-}
-
-bool GameController::doesPlayerShootRock(int shot) {
-    for (size_t rock = 0; rock < m_Rocks.size(); rock++) {
-        if (m_Rocks[rock] && m_Rocks[rock]->active && !m_Rocks[rock]->destroyed) {
-            // Use SimpleRock properties for collision detection
-            omegarace::Vector2f rockLocation = m_Rocks[rock]->position;
-            float rockRadius = 20.0f; // SimpleRock collision radius
-
-            if (pThePlayer->getShotCircle(rockLocation, rockRadius, shot)) {
-                // Rock is destroyed - use proper method to synchronize all variables
-                m_Rocks[rock]->setDestroyed(true);
-                m_Rocks[rock]->triggerDustExplosion();
-
-                // Play explosion sound through FMOD system
-                // AudioEngine::PlaySoundFile("RockHit");
-
-                return true;
-            }
+    for (int live = 0; live < m_Rocks.size(); live++) {
+        Rock* rock = m_Rocks.at(m_Rocks.liveSlot(live));
+        if (!rock->isDestroyed()) {
+            rock->draw();
         }
     }
-    return false;
-}
-
-bool GameController::doesRockCollideWithPlayer(int rockIndex) {
-    if (rockIndex < 0 || rockIndex >= (int)m_Rocks.size() || !m_Rocks[rockIndex]) {
-        return false;
-    }
-
-    omegarace::Rock* pRock = m_Rocks[rockIndex];
-    if (!pRock->active || pRock->destroyed) {
-        return false;
-    }
-
-    // Use Rock properties for collision detection
-    omegarace::Vector2f rockLocation = pRock->position;
-    float rockRadius = 20.0f; // Rock collision radius
-
-    return pThePlayer->circlesIntersect(rockLocation, rockRadius);
 }
 
 // UFO system methods
@@ -1040,7 +956,7 @@ void GameController::spawnUFO(int waveNumber) {
     }
 
     // Determine spawn side (random)
-    bool fromLeft = (rand() % 2) == 0;
+    bool fromLeft = Random::Int(Random::STREAM_WAVES, 0, 1) == 0;
 
     // Spawn location
     omegarace::Vector2f spawnLocation;
@@ -1049,7 +965,7 @@ void GameController::spawnUFO(int waveNumber) {
     } else {
         spawnLocation.x = (float)omegarace::Window::GetWindowSize().x + 50.0f; // Off right edge
     }
-    spawnLocation.y = 100.0f + (rand() % 400); // Random vertical position
+    spawnLocation.y = 100.0f + Random::Int(Random::STREAM_WAVES, 0, 399); // Random vertical position
 
     m_UFO->activate(spawnLocation, fromLeft);
 }
@@ -1066,7 +982,7 @@ void GameController::updateUFO(double frame) {
         spawnUFO(m_CurrentWave);
         m_UFOSpawnTimer = 0.0f;
         // Randomize next spawn interval
-        m_UFOSpawnInterval = 10.0f + ((rand() % 100) * 0.1f); // 10-20 seconds
+        m_UFOSpawnInterval = 10.0f + (Random::Int(Random::STREAM_WAVES, 0, 99) * 0.1f); // 10-20 seconds
     }
 
     // Update UFO if active
@@ -1076,53 +992,19 @@ void GameController::updateUFO(double frame) {
 }
 
 void GameController::drawUFO() {
-    if (m_UFO && (m_UFO->isActive() || m_UFO->isExplosionActive())) {
-        m_UFO->draw(); // This now handles both UFO and explosion drawing
-    }
-}
-
-bool GameController::doesPlayerShootUFO(int shot) {
-    if (!m_UFO || !m_UFO->isActive() || m_UFO->isDestroyed()) {
-        return false;
+    if (m_UFO && m_UFO->isActive()) {
+        m_UFO->draw();
     }
-
-    omegarace::Vector2f ufoLocation = m_UFO->getLocation();
-    float ufoRadius = m_UFO->getRadius();
-
-    if (pThePlayer->getShotCircle(ufoLocation, ufoRadius, shot)) {
-        // UFO is destroyed - trigger spectacular explosion
-        m_UFO->setDestroyed(true);
-        m_UFO->setActive(false);
-        m_UFO->triggerExplosion(); // Trigger custom UFO explosion
-
-        // Award points for UFO destruction (high value)
-        m_Score += 1500;
-        checkBonusLife();
-
-        // Play explosion sound through FMOD system
-        // AudioEngine::PlaySoundFile("UFOHit");
-
-        return true;
-    }
-    return false;
-}
-
-bool GameController::doesUFOCollideWithPlayer() {
-    if (!m_UFO || !m_UFO->isActive() || m_UFO->isDestroyed()) {
-        return false;
-    }
-
-    omegarace::Vector2f ufoLocation = m_UFO->getLocation();
-    float ufoRadius = m_UFO->getRadius();
-
-    return pThePlayer->circlesIntersect(ufoLocation, ufoRadius);
 }
 
 void GameController::onScreenSizeChanged() {
     // Reinitialize UI components that depend on screen size
     pTheBorders->initialize();
 
+    // Also marks the HUD and pause panel dirty: a pipelined frame dropped on resize may have held
+    // their last layer re-render
     pStatus->initialize();
+    pPauseMenu->initialize();
 
     // Update inside border for player and enemies
     pThePlayer->setInsideBorder(pTheBorders->getInsideBorder());
@@ -1131,10 +1013,11 @@ void GameController::onScreenSizeChanged() {
 
 void GameController::completeWaveCleanup() {
     // Destroy all remaining active rocks with spectacular dust explosions
-    for (size_t i = 0; i < m_Rocks.size(); i++) {
-        if (m_Rocks[i] && !m_Rocks[i]->isDestroyed()) {
-            m_Rocks[i]->setDestroyed(true);
-            m_Rocks[i]->triggerDustExplosion();
+    for (int live = 0; live < m_Rocks.size(); live++) {
+        Rock* rock = m_Rocks.at(m_Rocks.liveSlot(live));
+        if (!rock->isDestroyed()) {
+            rock->setDestroyed(true);
+            rock->triggerDustExplosion();
 
             // Award small bonus points for automatic rock destruction
             m_Score += 100;
@@ -1162,11 +1045,7 @@ void GameController::completeWaveCleanup() {
 
 void GameController::resetAllEntityStates() {
     // Reset player shots - deactivate any active bullets
-    for (int shot = 0; shot < pThePlayer->getNumberOfShots(); shot++) {
-        if (pThePlayer->getShotActive(shot)) {
-            pThePlayer->setShotActive(shot, false);
-        }
-    }
+    Projectiles::Clear(Projectiles::OWNER_PLAYER);
 
     // Clear player vapor trail
     pThePlayer->clearVaporTrail();
@@ -1187,199 +1066,153 @@ void GameController::resetAllEntityStates() {
         }
 
         // Clear Fighter mines
-        for (int mine = 0; mine < pFighter->getMineCount(); mine++) {
-            if (pFighter->getMineActive(mine)) {
-                pFighter->mineHit(mine); // This deactivates the mine
-            }
+        for (int mine = pFighter->getMineCount() - 1; mine >= 0; mine--) {
+            pFighter->mineHit(pFighter->getMineHandle(mine)); // This deactivates and frees the mine
         }
     }
 
     // Reset FollowEnemy states
     if (pFollower) {
         // Clear FollowEnemy mines
-        for (int mine = 0; mine < pFollower->getMineCount(); mine++) {
-            if (pFollower->getMineActive(mine)) {
-                pFollower->mineHit(mine); // This deactivates the mine
-            }
+        for (int mine = pFollower->getMineCount() - 1; mine >= 0; mine--) {
+            pFollower->mineHit(pFollower->getMineHandle(mine)); // This deactivates and frees the mine
         }
     }
 
     // Clear all enemy vapor trails (includes all enemy ships)
     pTheEnemyController->clearAllVaporTrails();
 
-    // Force reset UFO explosion states immediately (don't wait for natural fade)
-    if (m_UFO) {
-        m_UFO->forceResetExplosion();
-    }
-
-    // Reset all rock dust explosions immediately
-    for (size_t i = 0; i < m_Rocks.size(); i++) {
-        if (m_Rocks[i]) {
-            m_Rocks[i]->forceResetDustExplosion();
-        }
-    }
+    // Drop UFO debris, rock dust and sparks immediately (don't wait for natural fade)
+    ParticleSystem::Clear();
 
     // Reset the warp grid background to clear distortion effects
     pTheBorders->resetGridBackground();
 }
 
-void GameController::handlePauseInput() {
-    // Only allow pausing during active gameplay (not in menu, game over, or instructions)
-    if (!pThePlayer->getActive() || pStatus->getState() != StatusDisplay::APP_PLAYING) {
-        return; // Don't allow pause in non-gameplay states
-    }
-    
-    // P key toggles pause - use both key pressed (single frame) and key down (sustained) detection for reliability
+uint16_t GameController::samplePauseInput() {
+    uint16_t buttons = 0;
+
+    // P key toggles pause - use key down (sustained) with rising edge detection for reliability
     static bool lastPKeyState = false;
-    bool currentPKeyState = InputManager::IsKeyDown(KEY_P);
-    
-    // Detect rising edge (key was just pressed) - more reliable than IsKeyPressed alone
+    bool currentPKeyState = Platform::Input().isKeyDown(KEY_P);
     if (currentPKeyState && !lastPKeyState) {
-        togglePause();
-        lastPKeyState = currentPKeyState;
-        return; // Exit early to prevent processing menu inputs on the same frame
+        buttons |= TickInput::PAUSE;
     }
     lastPKeyState = currentPKeyState;
-    
-    // Handle controller pause input (works in all game states)
-    if (InputManager::IsControllerConnected()) {
-        int gamepadId = 0; // InputManager handles controller detection internally
-        
-        // Static variables for edge detection of pause buttons
-        static bool lastOptionsState = false;
-        static bool lastShareState = false;
-        
-        // Use same edge detection pattern as keyboard input
-        bool currentOptionsState = InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_MIDDLE_RIGHT);
-        bool currentShareState = InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_MIDDLE_LEFT);
-        
-        // Options button for RESUME game (start new game logic moved to main update)
-        if (currentOptionsState && !lastOptionsState) {
-            if (pThePlayer->getActive() && m_IsPaused) {
-                // Game is paused - resume
-                togglePause(); // This will unpause
-                lastOptionsState = currentOptionsState;
-                return;
-            }
-            // Note: New game logic is now handled in main update method before handlePauseInput
-        }
-        lastOptionsState = currentOptionsState;
 
-        // Share button for PAUSE/UNPAUSE during active gameplay
-        if (currentShareState && !lastShareState) {
-            if (pThePlayer->getActive() && !m_IsPaused) {
-                // During active gameplay - pause the game
-                togglePause();
-                lastShareState = currentShareState;
-                return;
-            } else if (pThePlayer->getActive() && m_IsPaused) {
-                // Game is paused - unpause it
-                togglePause();
-                lastShareState = currentShareState;
-                return;
-            }
-            // If player not active, Share does nothing
-        }
-        lastShareState = currentShareState;
-    }
-    
-    // Only handle menu navigation if we're actually paused and menu is visible
-    if (!m_IsPaused || !pPauseMenu->isVisible()) {
-        return;
-    }
-    
-    // Handle pause menu navigation with reliable edge detection
+    // Up/Down arrow keys or W/S for menu navigation using edge detection
     static bool lastUpKeyState = false;
     static bool lastDownKeyState = false;
     static bool lastSelectKeyState = false;
-    
-    // Up/Down arrow keys or W/S for menu navigation using edge detection
-    bool currentUpKeyState = InputManager::IsKeyDown(KEY_UP) || InputManager::IsKeyDown(KEY_W);
+
+    bool currentUpKeyState = Platform::Input().isKeyDown(KEY_UP) || Platform::Input().isKeyDown(KEY_W);
     if (currentUpKeyState && !lastUpKeyState) {
-        pPauseMenu->handleUp();
+        buttons |= TickInput::MENU_UP;
     }
     lastUpKeyState = currentUpKeyState;
-    
-    bool currentDownKeyState = InputManager::IsKeyDown(KEY_DOWN) || InputManager::IsKeyDown(KEY_S);
+
+    bool currentDownKeyState = Platform::Input().isKeyDown(KEY_DOWN) || Platform::Input().isKeyDown(KEY_S);
     if (currentDownKeyState && !lastDownKeyState) {
-        pPauseMenu->handleDown();
+        buttons |= TickInput::MENU_DOWN;
     }
     lastDownKeyState = currentDownKeyState;
-    
+
     // Space or Fire key to select menu option using edge detection
-    bool currentSelectKeyState = InputManager::IsKeyDown(KEY_SPACE) || InputManager::IsKeyDown(KEY_LEFT_CONTROL);
+    bool currentSelectKeyState = Platform::Input().isKeyDown(KEY_SPACE) || Platform::Input().isKeyDown(KEY_LEFT_CONTROL);
     if (currentSelectKeyState && !lastSelectKeyState) {
-        PauseMenu::MENU_OPTION selectedOption = pPauseMenu->getSelectedOption();
-        
-        // Handle the selected option
-        if (selectedOption == PauseMenu::RESUME) {
-            // Resume the game directly with explicit state management
-            pPauseMenu->hide();
-            m_IsPaused = false;
-            // Explicitly ensure the menu is not visible
-            if (pPauseMenu->isVisible()) {
-                pPauseMenu->hide();
-            }
-        } else if (selectedOption == PauseMenu::QUIT) {
-            // End the game the same way as when player runs out of lives
-            pPauseMenu->hide();
-            pThePlayer->setActive(false);
-            pTheBorders->resetGridBackground(); // Reset grid distortion when player becomes inactive
-            pStatus->setState(StatusDisplay::APP_GAMEOVER);
-            m_State = 1;
-            m_IsPaused = false; // Unpause to allow game over state to display
-        }
+        buttons |= TickInput::MENU_SELECT;
     }
     lastSelectKeyState = currentSelectKeyState;
-    
-    // Handle controller input for pause menu with same edge detection pattern as keyboard
-    if (InputManager::IsControllerConnected()) {
-        int gamepadId = 0; // InputManager handles controller detection internally
-        
-        // Static variables for gamepad edge detection (same pattern as keyboard)
+
+    // Controller pause and menu input with the same edge detection pattern as the keyboard
+    if (Platform::Input().isControllerConnected()) {
+        int gamepadId = 0; // the input source handles controller detection
+
+        static bool lastOptionsState = false;
+        static bool lastShareState = false;
         static bool lastGamepadUpState = false;
         static bool lastGamepadDownState = false;
         static bool lastGamepadSelectState = false;
-        
+
+        // Options button resumes a paused game (it also starts new games, see handleInput)
+        bool currentOptionsState = Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_MIDDLE_RIGHT);
+        if (currentOptionsState && !lastOptionsState) {
+            buttons |= TickInput::RESUME;
+        }
+        lastOptionsState = currentOptionsState;
+
+        // Share button for PAUSE/UNPAUSE during active gameplay
+        bool currentShareState = Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_MIDDLE_LEFT);
+        if (currentShareState && !lastShareState) {
+            buttons |= TickInput::PAUSE;
+        }
+        lastShareState = currentShareState;
+
         // D-pad navigation with edge detection
-        bool currentGamepadUpState = InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_DPAD_UP);
+        bool currentGamepadUpState = Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_DPAD_UP);
         if (currentGamepadUpState && !lastGamepadUpState) {
-            pPauseMenu->handleUp();
+            buttons |= TickInput::MENU_UP;
         }
         lastGamepadUpState = currentGamepadUpState;
-        
-        bool currentGamepadDownState = InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_DPAD_DOWN);
+
+        bool currentGamepadDownState = Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_DPAD_DOWN);
         if (currentGamepadDownState && !lastGamepadDownState) {
-            pPauseMenu->handleDown();
+            buttons |= TickInput::MENU_DOWN;
         }
         lastGamepadDownState = currentGamepadDownState;
-        
+
         // Face buttons (X, A) for select with edge detection
-        bool currentGamepadSelectState = InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_A) || 
-                                        InputManager::IsGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_X);
+        bool currentGamepadSelectState = Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_A) ||
+                                         Platform::Input().isGamepadButtonDown(gamepadId, GAMEPAD_BUTTON_X);
         if (currentGamepadSelectState && !lastGamepadSelectState) {
-            PauseMenu::MENU_OPTION selectedOption = pPauseMenu->getSelectedOption();
-            
-            if (selectedOption == PauseMenu::RESUME) {
-                // Resume the game directly with explicit state management
-                pPauseMenu->hide();
-                m_IsPaused = false;
-                // Explicitly ensure the menu is not visible
-                if (pPauseMenu->isVisible()) {
-                    pPauseMenu->hide();
-                }
-            } else if (selectedOption == PauseMenu::QUIT) {
-                // End the game the same way as when player runs out of lives
-                pPauseMenu->hide();
-                pThePlayer->setActive(false);
-                pTheBorders->resetGridBackground(); // Reset grid distortion when player becomes inactive
-                pStatus->setState(StatusDisplay::APP_GAMEOVER);
-                m_State = 1;
-                m_IsPaused = false; // Unpause to allow game over state to display
-            }
+            buttons |= TickInput::MENU_SELECT;
         }
         lastGamepadSelectState = currentGamepadSelectState;
     }
+
+    return buttons;
+}
+
+void GameController::applyPauseInput(const TickInput& input) {
+    // Only allow pausing during active gameplay (not in menu, game over, or instructions)
+    if (!pThePlayer->getActive() || pStatus->getState() != StatusDisplay::APP_PLAYING) {
+        return; // Don't allow pause in non-gameplay states
+    }
+
+    if (input.has(TickInput::PAUSE) || (input.has(TickInput::RESUME) && m_IsPaused)) {
+        togglePause();
+        return; // Exit early to prevent processing menu inputs on the same tick
+    }
+
+    // Only handle menu navigation if we're actually paused and menu is visible
+    if (!m_IsPaused || !pPauseMenu->isVisible()) {
+        return;
+    }
+
+    if (input.has(TickInput::MENU_UP)) {
+        pPauseMenu->handleUp();
+    }
+    if (input.has(TickInput::MENU_DOWN)) {
+        pPauseMenu->handleDown();
+    }
+    if (!input.has(TickInput::MENU_SELECT)) {
+        return;
+    }
+
+    PauseMenu::MENU_OPTION selectedOption = pPauseMenu->getSelectedOption();
+    if (selectedOption == PauseMenu::RESUME) {
+        // Resume the game directly with explicit state management
+        pPauseMenu->hide();
+        m_IsPaused = false;
+    } else if (selectedOption == PauseMenu::QUIT) {
+        // End the game the same way as when player runs out of lives
+        pPauseMenu->hide();
+        pThePlayer->setActive(false);
+        pTheBorders->resetGridBackground(); // Reset grid distortion when player becomes inactive
+        pStatus->setState(StatusDisplay::APP_GAMEOVER);
+        m_State = 1;
+        m_IsPaused = false; // Unpause to allow game over state to display
+    }
 }
 
 void omegarace::GameController::togglePause() {
@@ -1439,4 +1272,12 @@ float omegarace::GameController::getWarpIntensity() const {
     return intensity;
 }
 
+int omegarace::GameController::getCurrentWave() const {
+    return m_CurrentWave;
+}
+
+int omegarace::GameController::getScore() const {
+    return m_Score;
+}
+
 } // namespace omegarace
@@ -1,16 +1,17 @@
 #pragma once
 
-#include "AudioEngine.h"
 #include "Borders.h"
 #include "EnemyController.h"
 #include "PauseMenu.h"
 #include "Player.h"
+#include "Pool.h"
+#include "Replay.h"
 #include "Rock.h"
+#include "SpatialHash.h"
 #include "StatusDisplay.h"
 #include "UFO.h"
 #include "Window.h"
 #include "vmath.h"
-#include <random>
 #include <vector>
 
 // Simple UFO wrapper for easier integration
@@ -24,8 +25,7 @@ class GameController : Common {
     void initialize();
     void draw();
     void update(double frame);
-    void handleInput(); // Replaced SDL event handling with direct input handling
-    void onPause(bool paused);
+    void handleInput(); // Samples keyboard/controller into the input the next update() acts on
     void onScreenSizeChanged(); // NEW: Handle screen size changes for fullscreen
     
     // NEW: Get player position for grid distortion effects
@@ -33,6 +33,16 @@ class GameController : Common {
     bool isPlayerActive() const; // NEW: Check if player is active for grid distortion
     bool isWarpActive() const;   // NEW: Check if warp transition is active
     float getWarpIntensity() const; // NEW: Get current warp intensity for grid surge effect
+    int getCurrentWave() const;     // Waves spawned since the last new game, starting at 1
+    int getScore() const;
+
+    // Seeds every Random stream; the seed is stored in any replay recorded afterwards
+    void seedRandom(uint32_t seed);
+    // Record every tick's input to a replay file, or play one back in place of live input. Start
+    // either before the first update(); replay also restores the recorded seed.
+    bool startRecording(const std::string& path);
+    bool startReplay(const std::string& path);
+    bool isReplayFinished() const;
 
   private:
     void newGame();
@@ -40,6 +50,7 @@ class GameController : Common {
     void spawnNewWave(int ships);
     bool playerHit();
     void triggerWarpTransition(float duration = 2.0f); // NEW: Warp effect trigger
+    void updateWarpTransition();                       // Ends the warp once its duration of game time has run
     void completeWaveCleanup();                        // NEW: Destroy all remaining rocks and UFOs when wave ends
     void resetAllEntityStates();                       // NEW: Reset all entity states to prevent carryover
 
@@ -47,30 +58,11 @@ class GameController : Common {
     void spawnRocks(int waveNumber);
     void updateRocks(double frame);
     void drawRocks();
-    bool doesPlayerShootRock(int shot);
-    bool doesRockCollideWithPlayer(int rock);
 
     // UFO system methods
     void spawnUFO(int waveNumber);
     void updateUFO(double frame);
     void drawUFO();
-    bool doesPlayerShootUFO(int shot);
-    bool doesUFOCollideWithPlayer();
-
-    bool doesPlayerShotEnemy(int shot);
-    bool doesPlayerShootLeadEnemy(int shot);
-    bool doesPlayerShootFollowEnemy(int shot);
-    bool doesPlayerShootFighter(int shot);
-    bool doesPlayerShootFollowMine(int shot);
-    bool doesPlayerShootFighterMine(int shot);
-    bool doesEnemyCollideWithPlayer(int ship);
-    bool doesLeadCollideWithPlayer();
-    bool doesFollowCollideWithPlayer();
-    bool doesFighterCollideWithPlayer();
-    bool doesFollowMineHitPalyer(int mine);
-    bool doesFighterMineHitPlayer(int mine);
-    bool doesLeadShootPlayer();
-    bool doesFighterShootPlayer();
 
     Fighter* pFighter = nullptr;
     FollowEnemy* pFollower = nullptr;
@@ -82,8 +74,36 @@ class GameController : Common {
     std::unique_ptr<StatusDisplay> pStatus;
     std::unique_ptr<PauseMenu> pPauseMenu;
 
+    // Collision: every collidable's circle goes into m_Colliders once per tick, the grid finds the
+    // overlaps, and CollisionRules (GameController.cpp) says what each overlapping pair does
+    enum ColliderType {
+        COLLIDER_ENEMY,
+        COLLIDER_LEAD,
+        COLLIDER_FOLLOWER,
+        COLLIDER_FIGHTER,
+        COLLIDER_FOLLOW_MINE,
+        COLLIDER_FIGHTER_MINE,
+        COLLIDER_LEAD_SHOT,
+        COLLIDER_FIGHTER_SHOT,
+        COLLIDER_ROCK,
+        COLLIDER_UFO,
+        COLLIDER_PLAYER,      // probes only: never in the grid
+        COLLIDER_PLAYER_SHOT,
+        COLLIDER_KIND_COUNT
+    };
+    static constexpr float COLLISION_CELL_SIZE = 64.0f;
+    static constexpr float ROCK_COLLISION_RADIUS = 20.0f;
+    void fillColliders();
+    void addCollider(const Vector2f& location, float radius, ColliderType type, int owner);
+    bool resolveCollision(int first, int second); // applies the pair's CollisionRules entry, if any
+    friend struct CollisionRules;
+    ColliderTable m_Colliders;
+    SpatialHash m_CollisionGrid;
+    std::vector<int> m_CollisionHits;
+
     // Rock system
-    std::vector<omegarace::Rock*> m_Rocks;
+    static constexpr int MAX_ROCKS = 16; // 8 per wave, plus a wave's worth still being freed
+    Pool<Rock, MAX_ROCKS> m_Rocks;
     int m_CurrentWave;
     // Note: FMOD audio system is used instead of Mix_Chunk
 
@@ -110,8 +130,6 @@ class GameController : Common {
     bool m_IsFirstWave;
     bool m_WaitingForWarp; // NEW: Flag to indicate we're waiting for warp to complete before spawning
 
-    // Random number generator for Rock creation
-    std::mt19937 m_RandomGenerator;
 
     // Bonus life system
     int m_NextBonusLifeThreshold;
@@ -119,8 +137,18 @@ class GameController : Common {
     
     // Pause system
     bool m_IsPaused;
-    void handlePauseInput();
+    uint16_t samplePauseInput();
+    void applyPauseInput(const TickInput& input);
     void togglePause();
+
+    // Per-tick input: sampled by handleInput(), consumed (and recorded or replayed) by update()
+    TickInput nextTickInput();
+    void applyGameInput(const TickInput& input);
+    TickInput m_PendingInput;
+    uint64_t m_InputTick;
+    uint32_t m_Seed;
+    std::unique_ptr<ReplayWriter> m_ReplayWriter;
+    std::unique_ptr<ReplayReader> m_ReplayReader;
     
     // Input state tracking to prevent rapid fire
     bool m_SpaceKeyWasPressed;
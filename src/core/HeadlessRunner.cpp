@@ -0,0 +1,102 @@
+#include "HeadlessRunner.h"
+#include "GameController.h"
+#include "Jobs.h"
+#include "Logger.h"
+#include "SimClock.h"
+#include "Window.h"
+#include <chrono>
+#include <iostream>
+
+namespace omegarace {
+
+bool AutopilotInput::isKeyPressed(int key) {
+    // New game is only accepted while the player is inactive, so asking once a second is enough
+    return key == KEY_N && m_Tick % 60 == 0;
+}
+
+bool AutopilotInput::isKeyDown(int key) {
+    switch (key) {
+        case KEY_A:
+            return (m_Tick / 90) % 3 != 2;
+        case KEY_W:
+            return (m_Tick / 45) % 4 == 0;
+        case KEY_SPACE:
+            return (m_Tick / 6) % 2 == 0; // GameController fires on the press edge
+        default:
+            return false;
+    }
+}
+
+HeadlessRunner::HeadlessRunner(uint64_t tickLimit) : m_TickLimit(tickLimit) {
+}
+
+int HeadlessRunner::run() {
+    // The Noop renderer only backs the buffers and layers entities create during initialize();
+    // nothing is drawn or presented while the simulation runs
+    try {
+        Window::Init(1024, 768, "Omega Race", true);
+    } catch (const std::runtime_error& error) {
+        Window::logError(std::cout, "Headless init error: " + std::string(error.what()));
+        Window::Quit();
+        return -1;
+    }
+
+    Jobs::Init();
+    Platform::SetAudio(nullptr);
+    Platform::SetInput(&m_Input);
+
+    {
+        GameController controller;
+        if ((!m_ReplayPath.empty() && !controller.startReplay(m_ReplayPath)) ||
+            (!m_RecordPath.empty() && !controller.startRecording(m_RecordPath))) {
+            Platform::SetInput(nullptr);
+            Jobs::Shutdown();
+            Window::Quit();
+            return -1;
+        }
+        controller.initialize();
+
+        uint64_t waves = 0;
+        int lastWave = controller.getCurrentWave();
+        double updateSeconds = 0.0;
+        uint64_t ticks = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        while ((m_TickLimit == 0 || ticks < m_TickLimit) && !controller.isReplayFinished()) {
+            m_Input.setTick(ticks);
+
+            auto tickStart = std::chrono::steady_clock::now();
+            controller.handleInput();
+            controller.update(TICK_TIME);
+            updateSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - tickStart).count();
+            ticks++;
+
+            int wave = controller.getCurrentWave();
+            if (wave > lastWave) {
+                waves += wave - lastWave;
+            }
+            lastWave = wave;
+
+            if (ticks % REPORT_INTERVAL == 0) {
+                Logger::Info("Headless: " + std::to_string(ticks) + " ticks, " + std::to_string(waves) +
+                             " waves, " + std::to_string(updateSeconds * 1e6 / ticks) + " us/tick");
+            }
+        }
+
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "ticks " << ticks << "\n"
+                  << "sim_seconds " << SimClock::Seconds() << "\n"
+                  << "waves " << waves << "\n"
+                  << "score " << controller.getScore() << "\n"
+                  << "wall_seconds " << wallSeconds << "\n"
+                  << "ticks_per_second " << (wallSeconds > 0.0 ? ticks / wallSeconds : 0.0) << "\n"
+                  << "us_per_tick " << (ticks > 0 ? updateSeconds * 1e6 / ticks : 0.0) << std::endl;
+    }
+
+    Platform::SetInput(nullptr);
+    Jobs::Shutdown();
+    Window::Quit();
+    return 0;
+}
+
+} // namespace omegarace
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Platform.h"
+#include <cstdint>
+#include <string>
+
+namespace omegarace {
+
+// Drives the simulation with no window, vsync or audio: an input pattern derived from the tick
+// number keeps the ship turning, thrusting and firing, and starts a new game whenever it ends.
+class AutopilotInput : public InputSource {
+  public:
+    void setTick(uint64_t tick) { m_Tick = tick; }
+
+    bool isKeyPressed(int key) override;
+    bool isKeyDown(int key) override;
+
+  private:
+    uint64_t m_Tick = 0;
+};
+
+// Steps GameController::update back to back, as fast as the CPU allows, and reports the cost per
+// tick. Used to soak-test waves on build machines.
+class HeadlessRunner {
+  public:
+    // tickLimit of 0 runs until the process is killed
+    explicit HeadlessRunner(uint64_t tickLimit);
+
+    // Record the autopilot's input, or replay a recorded session (including one played by hand)
+    // in its place; a replay stops the run when it ends
+    void setInputRecording(const std::string& path) { m_RecordPath = path; }
+    void setInputReplay(const std::string& path) { m_ReplayPath = path; }
+
+    int run();
+
+  private:
+    uint64_t m_TickLimit;
+    std::string m_RecordPath;
+    std::string m_ReplayPath;
+    AutopilotInput m_Input;
+
+    static constexpr double TICK_TIME = 1.0 / 60.0;
+    static constexpr uint64_t REPORT_INTERVAL = 60 * 60; // one minute of game time
+};
+
+} // namespace omegarace
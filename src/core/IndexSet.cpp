@@ -0,0 +1,47 @@
+#include "IndexSet.h"
+
+namespace omegarace {
+
+IndexSet::IndexSet(int capacity) {
+    grow(capacity);
+}
+
+void IndexSet::grow(int capacity) {
+    for (int index = (int)m_Order.size(); index < capacity; index++) {
+        m_Position.push_back(index);
+        m_Order.push_back(index);
+    }
+}
+
+bool IndexSet::insert(int index) {
+    if (contains(index)) {
+        return false;
+    }
+    swapPositions(m_Position[index], m_Size);
+    m_Size++;
+    return true;
+}
+
+bool IndexSet::erase(int index) {
+    if (!contains(index)) {
+        return false;
+    }
+    m_Size--;
+    swapPositions(m_Position[index], m_Size);
+    return true;
+}
+
+void IndexSet::clear() {
+    m_Size = 0;
+}
+
+void IndexSet::swapPositions(int a, int b) {
+    int indexA = m_Order[a];
+    int indexB = m_Order[b];
+    m_Order[a] = indexB;
+    m_Order[b] = indexA;
+    m_Position[indexB] = a;
+    m_Position[indexA] = b;
+}
+
+} // namespace omegarace
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+
+namespace omegarace {
+
+// Splits the indices 0..capacity-1 into members and non-members, each side listed densely. Insert,
+// erase, membership and picking from either side are O(1), and walking a side costs only its size.
+// Erasing swaps the last member into the gap, so walk backwards when erasing as you go.
+class IndexSet {
+  public:
+    explicit IndexSet(int capacity = 0);
+
+    void grow(int capacity); // New indices start outside the set
+    bool insert(int index);  // false if already a member
+    bool erase(int index);   // false if not a member
+    void clear();
+
+    bool contains(int index) const { return m_Position[index] < m_Size; }
+    bool empty() const { return m_Size == 0; }
+    int size() const { return m_Size; }
+    int capacity() const { return (int)m_Order.size(); }
+    int operator[](int member) const { return m_Order[member]; }           // member < size()
+    int outsider(int nonMember) const { return m_Order[m_Size + nonMember]; } // nonMember < capacity() - size()
+
+  private:
+    void swapPositions(int a, int b);
+
+    std::vector<int> m_Order;    // Members first, then non-members
+    std::vector<int> m_Position; // Where each index sits in m_Order
+    int m_Size = 0;
+};
+
+} // namespace omegarace
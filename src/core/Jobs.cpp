@@ -0,0 +1,249 @@
+#include "Jobs.h"
+#include "Logger.h"
+#include <string>
+
+namespace omegarace {
+
+namespace {
+
+thread_local int tThreadIndex = 0;
+
+const int QUEUE_CAPACITY = 4096;
+
+} // namespace
+
+// Fixed ring of jobs behind a mutex: the owner pushes and pops at the newest end, thieves take from
+// the oldest end. Jobs are coarse enough that the lock is never the bottleneck.
+struct Jobs::Queue {
+    std::mutex mutex;
+    Job jobs[QUEUE_CAPACITY];
+    int oldest = 0;
+    int count = 0;
+
+    bool push(const Job& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == QUEUE_CAPACITY) {
+            return false;
+        }
+        jobs[(oldest + count) % QUEUE_CAPACITY] = job;
+        count++;
+        return true;
+    }
+
+    bool popNewest(Job& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == 0) {
+            return false;
+        }
+        count--;
+        job = jobs[(oldest + count) % QUEUE_CAPACITY];
+        return true;
+    }
+
+    bool stealOldest(Job& job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (count == 0) {
+            return false;
+        }
+        job = jobs[oldest];
+        oldest = (oldest + 1) % QUEUE_CAPACITY;
+        count--;
+        return true;
+    }
+};
+
+std::vector<std::thread> Jobs::mWorkers;
+std::unique_ptr<Jobs::Queue[]> Jobs::mQueues;
+std::vector<std::unique_ptr<ScratchArena>> Jobs::mScratch;
+std::atomic<int> Jobs::mQueued{0};
+std::atomic<int> Jobs::mSleeping{0};
+std::atomic<bool> Jobs::mQuit{false};
+std::mutex Jobs::mWakeMutex;
+std::condition_variable Jobs::mWake;
+
+ScratchArena::ScratchArena(size_t bytes) : m_Memory(new unsigned char[bytes]), m_Capacity(bytes), m_Used(0) {
+}
+
+void* ScratchArena::allocate(size_t bytes, size_t alignment) {
+    size_t start = (m_Used + alignment - 1) & ~(alignment - 1);
+    if (start + bytes > m_Capacity) {
+        return nullptr;
+    }
+    m_Used = start + bytes;
+    return m_Memory.get() + start;
+}
+
+void Jobs::Init(int workerCount) {
+    if (mQueues) {
+        return;
+    }
+    if (workerCount < 0) {
+        workerCount = (int)std::thread::hardware_concurrency() - 1;
+    }
+    workerCount = std::clamp(workerCount, 0, MAX_WORKERS);
+
+    mQuit = false;
+    mQueued = 0;
+    mSleeping = 0;
+    mQueues.reset(new Queue[workerCount + 1]);
+    for (int thread = 0; thread <= workerCount; thread++) {
+        mScratch.push_back(std::make_unique<ScratchArena>(SCRATCH_BYTES));
+    }
+    for (int worker = 1; worker <= workerCount; worker++) {
+        mWorkers.emplace_back(workerLoop, worker);
+    }
+
+    Logger::Info("Jobs: " + std::to_string(workerCount) + " workers");
+}
+
+void Jobs::Shutdown() {
+    if (!mQueues) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mWakeMutex);
+        mQuit = true;
+    }
+    mWake.notify_all();
+    for (std::thread& worker : mWorkers) {
+        worker.join();
+    }
+
+    mWorkers.clear();
+    mQueues.reset();
+    mScratch.clear();
+}
+
+int Jobs::WorkerCount() {
+    return (int)mWorkers.size();
+}
+
+int Jobs::ThreadCount() {
+    return (int)mWorkers.size() + 1;
+}
+
+int Jobs::ThreadIndex() {
+    return tThreadIndex;
+}
+
+ScratchArena& Jobs::Scratch() {
+    return *mScratch[tThreadIndex];
+}
+
+void Jobs::Submit(const Job& job) {
+    if (mWorkers.empty() || !mQueues[tThreadIndex].push(job)) {
+        runJob(job);
+        return;
+    }
+
+    // Either this sees the sleeper or the sleeper sees the job (both sides are sequentially consistent)
+    mQueued.fetch_add(1);
+    if (mSleeping.load() > 0) {
+        { std::lock_guard<std::mutex> lock(mWakeMutex); }
+        mWake.notify_one();
+    }
+}
+
+void Jobs::Wait(JobCounter& counter) {
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        Job job;
+        if (takeJob(job)) {
+            runJob(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Private methods ----------------------------------------------------------------
+void Jobs::workerLoop(int index) {
+    tThreadIndex = index;
+
+    while (!mQuit.load()) {
+        Job job;
+        if (takeJob(job)) {
+            runJob(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mWakeMutex);
+        mSleeping.fetch_add(1);
+        mWake.wait(lock, [] { return mQuit.load() || mQueued.load() > 0; });
+        mSleeping.fetch_sub(1);
+    }
+}
+
+bool Jobs::takeJob(Job& job) {
+    if (!mQueues || mQueued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    int threads = ThreadCount();
+    bool found = mQueues[tThreadIndex].popNewest(job);
+    for (int offset = 1; !found && offset < threads; offset++) {
+        found = mQueues[(tThreadIndex + offset) % threads].stealOldest(job);
+    }
+    if (found) {
+        mQueued.fetch_sub(1);
+    }
+    return found;
+}
+
+void Jobs::runJob(const Job& job) {
+    job.entry(job.context, job.begin, job.end);
+    if (job.counter) {
+        job.counter->pending.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+int TaskGraph::add(std::function<void()> task) {
+    auto node = std::make_unique<Node>();
+    node->task = std::move(task);
+    node->graph = this;
+    m_Nodes.push_back(std::move(node));
+    return (int)m_Nodes.size() - 1;
+}
+
+void TaskGraph::precede(int before, int after) {
+    m_Nodes[before]->successors.push_back(after);
+    m_Nodes[after]->predecessors++;
+}
+
+void TaskGraph::run() {
+    if (m_Nodes.empty()) {
+        return;
+    }
+
+    for (auto& node : m_Nodes) {
+        node->waiting.store(node->predecessors, std::memory_order_relaxed);
+    }
+    m_Counter.pending.store((int)m_Nodes.size(), std::memory_order_release);
+
+    // Every node counts against m_Counter from the start; a node is only queued once
+    for (auto& node : m_Nodes) {
+        if (node->predecessors == 0) {
+            submit(*node);
+        }
+    }
+    Jobs::Wait(m_Counter);
+}
+
+// Private methods ----------------------------------------------------------------
+void TaskGraph::runNode(const void* context, int, int) {
+    Node& node = *const_cast<Node*>(static_cast<const Node*>(context));
+    node.task();
+
+    // Queued before this node's own count drops, so run() can't return while a successor is pending
+    for (int successor : node.successors) {
+        Node& next = *node.graph->m_Nodes[successor];
+        if (next.waiting.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            node.graph->submit(next);
+        }
+    }
+}
+
+void TaskGraph::submit(Node& node) {
+    Jobs::Submit({runNode, &node, 0, 0, &m_Counter});
+}
+
+} // namespace omegarace
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace omegarace {
+
+// Counts the jobs of one fork still running; Jobs::Wait returns once it reaches zero
+struct JobCounter {
+    std::atomic<int> pending{0};
+};
+
+// Bump allocator for data that only lives as long as a job or a frame. Every thread has its own, so
+// allocating never locks; rewind to a mark (or use a ScratchScope) to give the memory back.
+class ScratchArena {
+  public:
+    explicit ScratchArena(size_t bytes);
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)); // nullptr when full
+    template <typename T>
+    T* allocate(int count) {
+        return static_cast<T*>(allocate(sizeof(T) * (size_t)count, alignof(T)));
+    }
+
+    size_t mark() const { return m_Used; }
+    void rewind(size_t mark) { m_Used = mark; }
+    size_t capacity() const { return m_Capacity; }
+
+  private:
+    std::unique_ptr<unsigned char[]> m_Memory;
+    size_t m_Capacity;
+    size_t m_Used;
+};
+
+// Work-stealing thread pool shared by simulation and render code. Each thread queues the jobs it forks
+// on its own deque and runs them newest first; an idle worker steals the oldest job from another
+// thread's deque. A thread waiting on a fork runs queued jobs instead of blocking, so forks nest.
+// Until Init is called, or with no workers, every job runs inline on the calling thread.
+class Jobs {
+  public:
+    using Entry = void (*)(const void* context, int begin, int end);
+    struct Job {
+        Entry entry;
+        const void* context;
+        int begin;
+        int end;
+        JobCounter* counter; // decremented after the job returns; may be null
+    };
+
+    static constexpr int MAX_WORKERS = 63;
+    static constexpr int CHUNKS_PER_THREAD = 4; // ParallelFor splits finer than the thread count to balance load
+    static constexpr size_t SCRATCH_BYTES = 1 << 20;
+
+    // -1 starts one worker per hardware thread beyond the caller; 0 runs everything on the caller.
+    // The calling thread becomes thread 0 and should be the one that forks most work.
+    static void Init(int workerCount = -1);
+    static void Shutdown(); // Waits for the workers to finish their current job; queued jobs are dropped
+
+    static int WorkerCount();
+    static int ThreadCount();  // Workers plus the thread that called Init
+    static int ThreadIndex();  // 0 off the workers, 1..WorkerCount() on them
+    static ScratchArena& Scratch(); // The calling thread's arena; only valid after Init
+
+    static void Submit(const Job& job);     // job.counter must already include this job
+    static void Wait(JobCounter& counter); // Runs queued jobs until the counter drains
+
+    // Calls function(begin, end) over slices of 0..count-1, no slice shorter than grain, and returns
+    // once every slice is done. The caller runs the first slice itself.
+    template <typename Function>
+    static void ParallelFor(int count, int grain, const Function& function);
+
+  private:
+    struct Queue;
+
+    static void workerLoop(int index);
+    static bool takeJob(Job& job);
+    static void runJob(const Job& job);
+
+    static std::vector<std::thread> mWorkers;
+    static std::unique_ptr<Queue[]> mQueues; // One per thread, indexed by ThreadIndex()
+    static std::vector<std::unique_ptr<ScratchArena>> mScratch;
+    static std::atomic<int> mQueued;   // Jobs sitting in any queue
+    static std::atomic<int> mSleeping; // Workers parked on mWake
+    static std::atomic<bool> mQuit;
+    static std::mutex mWakeMutex;
+    static std::condition_variable mWake;
+};
+
+// Rewinds the calling thread's scratch arena to where it stood when the scope opened
+class ScratchScope {
+  public:
+    ScratchScope() : m_Arena(Jobs::Scratch()), m_Mark(m_Arena.mark()) {}
+    ~ScratchScope() { m_Arena.rewind(m_Mark); }
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+  private:
+    ScratchArena& m_Arena;
+    size_t m_Mark;
+};
+
+// Tasks joined by ordering edges, built once and run as often as needed. run() queues every task with
+// no predecessors and returns once all have finished; each task is queued the moment its last
+// predecessor completes. The edges must not form a cycle.
+class TaskGraph {
+  public:
+    int add(std::function<void()> task); // Returns the task's id
+    void precede(int before, int after); // after waits for before
+    void run();
+
+    int size() const { return (int)m_Nodes.size(); }
+
+  private:
+    struct Node {
+        std::function<void()> task;
+        std::vector<int> successors;
+        int predecessors = 0;
+        std::atomic<int> waiting{0};
+        TaskGraph* graph = nullptr;
+    };
+
+    static void runNode(const void* context, int begin, int end);
+    void submit(Node& node);
+
+    std::vector<std::unique_ptr<Node>> m_Nodes;
+    JobCounter m_Counter;
+};
+
+template <typename Function>
+void Jobs::ParallelFor(int count, int grain, const Function& function) {
+    if (count <= 0) {
+        return;
+    }
+    grain = std::max(grain, 1);
+    int chunks = std::min((count + grain - 1) / grain, ThreadCount() * CHUNKS_PER_THREAD);
+    if (chunks <= 1) {
+        function(0, count);
+        return;
+    }
+
+    auto sliceStart = [count, chunks](int chunk) { return (int)((long long)count * chunk / chunks); };
+    Entry entry = [](const void* context, int begin, int end) {
+        (*static_cast<const Function*>(context))(begin, end);
+    };
+
+    JobCounter counter;
+    counter.pending.store(chunks - 1, std::memory_order_relaxed);
+    for (int chunk = 1; chunk < chunks; chunk++) {
+        Submit({entry, &function, sliceStart(chunk), sliceStart(chunk + 1), &counter});
+    }
+    function(0, sliceStart(1));
+    Wait(counter);
+}
+
+} // namespace omegarace
@@ -110,6 +110,7 @@ void Logger::WriteToLogFile(std::string type, std::string msg) {
     buf.append(type);
     buf.append(msg);
 
+    std::lock_guard<std::mutex> lock(logsMutex);
     std::ofstream logFile;
     logFile.open("elixir_" + dateStr + std::string(".log"), std::ios_base::app);
     logFile << buf << "\n";
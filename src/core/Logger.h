@@ -7,6 +7,7 @@
 
 #include <ctime>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -53,6 +54,7 @@ class Logger {
     static void Debug(std::string msg);
 
     inline static std::vector<std::string> GetLogs() {
+        std::lock_guard<std::mutex> lock(logsMutex);
         return logs;
     }
 
@@ -60,6 +62,7 @@ class Logger {
     static void WriteToLogFile(std::string type, std::string msg);
 
     inline static std::vector<std::string> logs{};
+    inline static std::mutex logsMutex{}; // The simulation may log from a job worker
 };
 
 } // namespace omegarace
@@ -0,0 +1,26 @@
+#include "Platform.h"
+
+namespace omegarace {
+
+AudioOutput Platform::mNullAudio;
+InputSource Platform::mNullInput;
+AudioOutput* Platform::mAudio = &Platform::mNullAudio;
+InputSource* Platform::mInput = &Platform::mNullInput;
+
+void Platform::SetAudio(AudioOutput* audio) {
+    mAudio = audio ? audio : &mNullAudio;
+}
+
+void Platform::SetInput(InputSource* input) {
+    mInput = input ? input : &mNullInput;
+}
+
+AudioOutput& Platform::Audio() {
+    return *mAudio;
+}
+
+InputSource& Platform::Input() {
+    return *mInput;
+}
+
+} // namespace omegarace
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Types.h"
+#include <string>
+
+namespace omegarace {
+
+// Sound the simulation asks for. The game binds FMOD through AudioEngine; the default output is
+// silent, so the simulation library never needs an audio device.
+class AudioOutput {
+  public:
+    virtual ~AudioOutput() = default;
+
+    virtual void init() {}
+    virtual void update() {}
+    virtual void shutdown() {}
+
+    virtual void loadBank(const std::string& bankName) { (void)bankName; }
+    virtual void loadSound(const std::string& soundName) { (void)soundName; }
+    virtual int playSound(const std::string& soundName) {
+        (void)soundName;
+        return -1;
+    }
+    virtual void stopChannel(int channelId) { (void)channelId; }
+    virtual void playEvent(const std::string& eventName) { (void)eventName; }
+};
+
+// Keyboard and gamepad state the simulation reads each tick, using the KEY_ and GAMEPAD_ values
+// from Types.h. The game binds InputManager; the default source has nothing pressed.
+class InputSource {
+  public:
+    virtual ~InputSource() = default;
+
+    virtual bool isKeyPressed(int key) {
+        (void)key;
+        return false;
+    }
+    virtual bool isKeyDown(int key) {
+        (void)key;
+        return false;
+    }
+    virtual bool isGamepadButtonPressed(int gamepad, int button) {
+        (void)gamepad;
+        (void)button;
+        return false;
+    }
+    virtual bool isGamepadButtonDown(int gamepad, int button) {
+        (void)gamepad;
+        (void)button;
+        return false;
+    }
+    virtual float getGamepadAxisMovement(int gamepad, int axis) {
+        (void)gamepad;
+        (void)axis;
+        return 0.0f;
+    }
+    virtual bool isControllerConnected() { return false; }
+};
+
+// The audio and input the simulation is currently bound to. Rendering is already behind the
+// Window facade, which runs on bgfx's Noop renderer when there is no display.
+class Platform {
+  public:
+    // Bind an output or source; nullptr restores the silent/idle default. Not owned.
+    static void SetAudio(AudioOutput* audio);
+    static void SetInput(InputSource* input);
+
+    static AudioOutput& Audio();
+    static InputSource& Input();
+
+  private:
+    static AudioOutput mNullAudio;
+    static InputSource mNullInput;
+    static AudioOutput* mAudio;
+    static InputSource* mInput;
+};
+
+} // namespace omegarace
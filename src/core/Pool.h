@@ -0,0 +1,93 @@
+#pragma once
+
+#include "IndexSet.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace omegarace {
+
+// Names one slot of a Pool at one point in its life. The generation changes every time the slot is
+// released, so a handle kept past its object's release no longer resolves.
+struct PoolHandle {
+    static constexpr uint16_t INVALID = 0xFFFF;
+
+    uint16_t index = INVALID;
+    uint16_t generation = 0;
+
+    bool valid() const { return index != INVALID; }
+    // Packs the handle into an int, for places that carry plain ids (collider owners)
+    int id() const { return (int)(((uint32_t)generation << 16) | index); }
+    static PoolHandle FromId(int id) { return {(uint16_t)(id & 0xFFFF), (uint16_t)((uint32_t)id >> 16)}; }
+};
+
+// Fixed-capacity storage for entities that come and go during play. Every object is built when the
+// pool is; acquire() hands out a free slot and release() returns it, so spawning and destroying never
+// allocates. Live slots are kept in an IndexSet, so walking them costs only the live count.
+template <typename T, int Capacity>
+class Pool {
+    static_assert(Capacity > 0 && Capacity < PoolHandle::INVALID, "pool capacity must fit a handle index");
+
+  public:
+    Pool() : Pool([] { return std::make_unique<T>(); }) {}
+
+    template <typename Factory>
+    explicit Pool(Factory make) : m_Live(Capacity) {
+        for (int slot = 0; slot < Capacity; slot++) {
+            m_Objects[slot] = make();
+            m_Generation[slot] = 0;
+        }
+    }
+
+    // Returns an invalid handle when every slot is in use; the object keeps whatever state it was
+    // released with, so the caller sets it up again
+    PoolHandle acquire() {
+        if (m_Live.size() == Capacity) {
+            return PoolHandle();
+        }
+        int slot = m_Live.outsider(0);
+        m_Live.insert(slot);
+        return {(uint16_t)slot, m_Generation[slot]};
+    }
+
+    // Stale and invalid handles are ignored
+    void release(PoolHandle handle) {
+        if (get(handle)) {
+            m_Live.erase(handle.index);
+            m_Generation[handle.index]++;
+        }
+    }
+
+    void clear() {
+        for (int live = size() - 1; live >= 0; live--) {
+            release(handleAt(liveSlot(live)));
+        }
+    }
+
+    // nullptr once the handle's object has been released
+    T* get(PoolHandle handle) const {
+        if (!handle.valid() || handle.index >= Capacity || !m_Live.contains(handle.index) ||
+            m_Generation[handle.index] != handle.generation) {
+            return nullptr;
+        }
+        return m_Objects[handle.index].get();
+    }
+
+    // For walking the live objects: liveSlot(0..size()-1). Releasing moves the last live slot into
+    // the gap, so walk backwards when releasing as you go.
+    int liveSlot(int live) const { return m_Live[live]; }
+    T* at(int slot) const { return m_Live.contains(slot) ? m_Objects[slot].get() : nullptr; }
+    PoolHandle handleAt(int slot) const {
+        return m_Live.contains(slot) ? PoolHandle{(uint16_t)slot, m_Generation[slot]} : PoolHandle();
+    }
+
+    int capacity() const { return Capacity; }
+    int size() const { return m_Live.size(); }
+
+  private:
+    std::array<std::unique_ptr<T>, Capacity> m_Objects;
+    std::array<uint16_t, Capacity> m_Generation;
+    IndexSet m_Live;
+};
+
+} // namespace omegarace
@@ -0,0 +1,76 @@
+#include "Random.h"
+
+namespace omegarace {
+
+namespace {
+
+uint32_t rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+} // namespace
+
+Random::State Random::mStreams[STREAM_COUNT];
+
+// Until the game seeds it, every run starts from the same streams
+static const bool sDefaultSeeded = (Random::Seed(0), true);
+
+void Random::Seed(uint32_t seed) {
+    for (int stream = 0; stream < STREAM_COUNT; stream++) {
+        // SplitMix64 spreads seed and stream number over the whole 128-bit state, which is never
+        // all zero
+        uint64_t mix = ((uint64_t)seed << 32) | (uint32_t)stream;
+        uint64_t low = splitMix64(mix);
+        uint64_t high = splitMix64(mix);
+        State& state = mStreams[stream];
+        state.s[0] = (uint32_t)low;
+        state.s[1] = (uint32_t)(low >> 32);
+        state.s[2] = (uint32_t)high;
+        state.s[3] = (uint32_t)(high >> 32);
+    }
+}
+
+uint32_t Random::Next(Stream stream) {
+    uint32_t* s = mStreams[stream].s;
+    const uint32_t result = rotl(s[1] * 5, 7) * 9;
+    const uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 11);
+    return result;
+}
+
+int Random::Int(Stream stream, int min, int max) {
+    if (max <= min) {
+        return min;
+    }
+    // Scale by multiplication rather than modulo; the span is computed wide so negative minimums
+    // and the full int range both work
+    uint64_t span = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+    return (int)((int64_t)min + (int64_t)(((uint64_t)Next(stream) * span) >> 32));
+}
+
+float Random::Float(Stream stream, float min, float max) {
+    // Top 24 bits give every float in [0, 1) an equal step
+    return min + (float)(Next(stream) >> 8) * (1.0f / 16777216.0f) * (max - min);
+}
+
+void Random::Fill(Stream stream, float* values, int count, float min, float max) {
+    const float scale = (1.0f / 16777216.0f) * (max - min);
+    for (int i = 0; i < count; i++) {
+        values[i] = min + (float)(Next(stream) >> 8) * scale;
+    }
+}
+
+} // namespace omegarace
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace omegarace {
+
+// Seedable random numbers, one independent xoshiro128** stream per subsystem. A subsystem only
+// ever advances its own stream, so drawing more or fewer effects never shifts a gameplay roll and
+// a replay reproduces its waves, AI and rocks from the seed alone.
+class Random {
+  public:
+    enum Stream {
+        STREAM_WAVES,   // Wave layout, spawn sides and timing, UFO appearances
+        STREAM_AI,      // Enemy steering, firing and mine laying
+        STREAM_ROCKS,   // Rock placement and shapes
+        STREAM_EFFECTS, // Explosions and particles spawned by the simulation
+        STREAM_DRAW,    // Jitter rolled inside draw(); advances once per rendered frame, not per tick
+        STREAM_COUNT
+    };
+
+    static void Seed(uint32_t seed); // Derives every stream from the one seed
+    static uint32_t Next(Stream stream);
+    static int Int(Stream stream, int min, int max); // min..max inclusive, either sign
+    static float Float(Stream stream, float min, float max);
+    static void Fill(Stream stream, float* values, int count, float min, float max);
+
+  private:
+    struct State {
+        uint32_t s[4];
+    };
+    static State mStreams[STREAM_COUNT];
+};
+
+} // namespace omegarace
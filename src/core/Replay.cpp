@@ -0,0 +1,201 @@
+#include "Replay.h"
+#include "Logger.h"
+#include <cstring>
+#include <iterator>
+
+namespace omegarace {
+
+static const char REPLAY_MAGIC[4] = {'O', 'R', 'P', 'L'};
+static const uint8_t REPLAY_VERSION = 1;
+static const size_t REPLAY_HEADER_SIZE = sizeof(REPLAY_MAGIC) + 1 + 4;
+
+ReplayWriter::ReplayWriter() : m_LastChangeTick(0), m_EndTick(0), m_LastButtons(0), m_Closing(false) {
+}
+
+ReplayWriter::~ReplayWriter() {
+    close();
+}
+
+bool ReplayWriter::open(const std::string& path, uint32_t seed) {
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File.is_open()) {
+        Logger::Error("Failed to open replay file for writing", path);
+        return false;
+    }
+
+    uint8_t header[REPLAY_HEADER_SIZE];
+    memcpy(header, REPLAY_MAGIC, sizeof(REPLAY_MAGIC));
+    header[4] = REPLAY_VERSION;
+    for (int i = 0; i < 4; i++) {
+        header[5 + i] = uint8_t(seed >> (8 * i));
+    }
+    m_File.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    m_Chunk.reserve(CHUNK_SIZE + 16);
+    m_Closing = false;
+    m_Thread = std::thread(&ReplayWriter::writeLoop, this);
+    return true;
+}
+
+void ReplayWriter::record(uint64_t tick, TickInput input) {
+    m_EndTick = tick + 1;
+    if (input.buttons == m_LastButtons) {
+        return;
+    }
+
+    appendVarint(tick - m_LastChangeTick);
+    appendVarint(uint16_t(input.buttons ^ m_LastButtons));
+    m_LastChangeTick = tick;
+    m_LastButtons = input.buttons;
+
+    if (m_Chunk.size() >= CHUNK_SIZE) {
+        queueChunk();
+    }
+}
+
+void ReplayWriter::close() {
+    if (!m_Thread.joinable()) {
+        return;
+    }
+
+    // End marker: the tick after the last one recorded, with nothing changing
+    appendVarint(m_EndTick - m_LastChangeTick);
+    appendVarint(0);
+    queueChunk();
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Closing = true;
+    }
+    m_Wake.notify_one();
+    m_Thread.join();
+    m_File.close();
+}
+
+void ReplayWriter::writeLoop() {
+    std::vector<std::vector<uint8_t>> chunks;
+    for (;;) {
+        bool closing;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Wake.wait(lock, [this] { return m_Closing || !m_Pending.empty(); });
+            chunks.swap(m_Pending);
+            closing = m_Closing;
+        }
+
+        for (const std::vector<uint8_t>& chunk : chunks) {
+            m_File.write(reinterpret_cast<const char*>(chunk.data()), std::streamsize(chunk.size()));
+        }
+        chunks.clear();
+
+        if (closing) {
+            m_File.flush();
+            return;
+        }
+    }
+}
+
+void ReplayWriter::appendVarint(uint64_t value) {
+    while (value >= 0x80) {
+        m_Chunk.push_back(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    m_Chunk.push_back(uint8_t(value));
+}
+
+void ReplayWriter::queueChunk() {
+    if (m_Chunk.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Pending.push_back(std::move(m_Chunk));
+    }
+    m_Wake.notify_one();
+
+    m_Chunk = std::vector<uint8_t>();
+    m_Chunk.reserve(CHUNK_SIZE + 16);
+}
+
+ReplayReader::ReplayReader()
+    : m_Offset(0), m_Seed(0), m_Buttons(0), m_NextXor(0), m_NextChangeTick(0), m_Ended(true) {
+}
+
+bool ReplayReader::open(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        Logger::Error("Failed to open replay file", path);
+        return false;
+    }
+    m_Data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    if (m_Data.size() < REPLAY_HEADER_SIZE || memcmp(m_Data.data(), REPLAY_MAGIC, sizeof(REPLAY_MAGIC)) != 0 ||
+        m_Data[4] != REPLAY_VERSION) {
+        Logger::Error("Not a replay file", path);
+        return false;
+    }
+
+    m_Seed = 0;
+    for (int i = 0; i < 4; i++) {
+        m_Seed |= uint32_t(m_Data[5 + i]) << (8 * i);
+    }
+
+    m_Offset = REPLAY_HEADER_SIZE;
+    m_Buttons = 0;
+    m_NextChangeTick = 0;
+    m_Ended = !readEntry();
+    return true;
+}
+
+TickInput ReplayReader::next(uint64_t tick) {
+    while (!m_Ended && tick >= m_NextChangeTick) {
+        if (m_NextXor == 0) {
+            m_Ended = true;
+            break;
+        }
+        m_Buttons ^= m_NextXor;
+        if (!readEntry()) {
+            Logger::Warn("Replay file is truncated; stopping playback");
+            m_Ended = true;
+        }
+    }
+
+    TickInput input;
+    if (!m_Ended) {
+        input.buttons = m_Buttons;
+    }
+    return input;
+}
+
+bool ReplayReader::finished(uint64_t tick) const {
+    return m_Ended || (m_NextXor == 0 && tick >= m_NextChangeTick);
+}
+
+bool ReplayReader::readEntry() {
+    uint64_t delta = 0;
+    uint64_t changed = 0;
+    if (!readVarint(delta) || !readVarint(changed)) {
+        return false;
+    }
+    m_NextChangeTick += delta;
+    m_NextXor = uint16_t(changed);
+    return true;
+}
+
+bool ReplayReader::readVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (m_Offset >= m_Data.size()) {
+            return false;
+        }
+        uint8_t byte = m_Data[m_Offset++];
+        value |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace omegarace
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace omegarace {
+
+// What GameController acts on for one tick once keyboard and gamepad have been merged. Turning and
+// thrust are held states; the rest are presses, set only on the tick that consumes them.
+struct TickInput {
+    enum : uint16_t {
+        TURN_LEFT = 1 << 0,
+        TURN_RIGHT = 1 << 1,
+        THRUST = 1 << 2,
+        FIRE = 1 << 3,
+        NEW_GAME = 1 << 4,
+        PAUSE = 1 << 5,  // P or Share: toggle pause
+        RESUME = 1 << 6, // Options: resume when paused
+        MENU_UP = 1 << 7,
+        MENU_DOWN = 1 << 8,
+        MENU_SELECT = 1 << 9,
+
+        HELD = TURN_LEFT | TURN_RIGHT | THRUST
+    };
+
+    uint16_t buttons = 0;
+
+    bool has(uint16_t button) const { return (buttons & button) != 0; }
+};
+
+// Replay file layout, all integers little-endian:
+//   "ORPL"  u8 version  u32 seed
+//   then one entry per input change: varint ticks since the previous change, varint buttons XOR
+//   the previous buttons. The last entry has an XOR of 0 and marks the tick the recording ended.
+// Inputs rarely change between ticks, so a minute of play is typically a few hundred bytes.
+
+// Encodes TickInputs as they happen and hands full chunks to a writer thread, so a slow disk
+// never stalls the tick that produced them.
+class ReplayWriter {
+  public:
+    ReplayWriter();
+    ~ReplayWriter();
+
+    bool open(const std::string& path, uint32_t seed);
+    // Ticks must be recorded in order, once each, starting from 0
+    void record(uint64_t tick, TickInput input);
+    void close();
+
+  private:
+    void writeLoop();
+    void appendVarint(uint64_t value);
+    void queueChunk();
+
+    std::ofstream m_File;
+    std::vector<uint8_t> m_Chunk;
+    uint64_t m_LastChangeTick;
+    uint64_t m_EndTick;
+    uint16_t m_LastButtons;
+
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    std::vector<std::vector<uint8_t>> m_Pending;
+    bool m_Closing;
+
+    static constexpr size_t CHUNK_SIZE = 4096;
+};
+
+// Plays a replay file back tick by tick in place of live input
+class ReplayReader {
+  public:
+    ReplayReader();
+
+    bool open(const std::string& path);
+    uint32_t seed() const { return m_Seed; }
+    // Ticks must be requested in order starting from 0
+    TickInput next(uint64_t tick);
+    // True once the recording has run out; later ticks get no input
+    bool finished(uint64_t tick) const;
+
+  private:
+    bool readEntry();
+    bool readVarint(uint64_t& value);
+
+    std::vector<uint8_t> m_Data;
+    size_t m_Offset;
+    uint32_t m_Seed;
+    uint16_t m_Buttons;
+    uint16_t m_NextXor;
+    uint64_t m_NextChangeTick;
+    bool m_Ended;
+};
+
+} // namespace omegarace
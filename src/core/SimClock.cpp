@@ -0,0 +1,32 @@
+#include "SimClock.h"
+
+namespace omegarace {
+
+double SimClock::mSeconds = 0.0;
+double SimClock::mStep = 1.0 / 60.0;
+uint64_t SimClock::mTicks = 0;
+
+void SimClock::Advance(double seconds) {
+    mSeconds += seconds;
+    mStep = seconds;
+    mTicks++;
+}
+
+void SimClock::Reset() {
+    mSeconds = 0.0;
+    mTicks = 0;
+}
+
+double SimClock::Seconds() {
+    return mSeconds;
+}
+
+uint64_t SimClock::Ticks() {
+    return mTicks;
+}
+
+double SimClock::Step() {
+    return mStep;
+}
+
+} // namespace omegarace
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+namespace omegarace {
+
+// Simulation clock. Only GameController::update advances it, one fixed step per tick, so every
+// Timer reads game time: pausing stops it in one place and runs are reproducible tick for tick.
+class SimClock {
+  public:
+    static void Advance(double seconds);
+    static void Reset(); // Back to tick 0; GameController does this when a run starts
+    static double Seconds();
+    static uint64_t Ticks();
+    static double Step(); // length of the last tick; a 60 Hz tick until the first Advance
+
+  private:
+    static double mSeconds;
+    static double mStep;
+    static uint64_t mTicks;
+};
+
+} // namespace omegarace
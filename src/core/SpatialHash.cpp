@@ -0,0 +1,101 @@
+#include "SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+namespace omegarace {
+
+SpatialHash::SpatialHash(float width, float height, float cellSize)
+    : m_InvCellSize(1.0f / cellSize), m_QueryId(0) {
+    m_Columns = std::max(1, (int)std::ceil(width / cellSize));
+    m_Rows = std::max(1, (int)std::ceil(height / cellSize));
+    m_CellStart.assign(m_Columns * m_Rows + 1, 0);
+}
+
+void SpatialHash::build(const ColliderTable& colliders) {
+    // Counting sort into flat arrays: count per cell, prefix-sum into start offsets, then fill
+    int cellCount = m_Columns * m_Rows;
+    std::fill(m_CellStart.begin(), m_CellStart.end(), 0);
+
+    int x0, y0, x1, y1;
+    for (int id = 0; id < colliders.size(); id++) {
+        cellRange(colliders.x(id), colliders.y(id), colliders.radius(id), x0, y0, x1, y1);
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                m_CellStart[y * m_Columns + x + 1]++;
+            }
+        }
+    }
+    for (int cell = 0; cell < cellCount; cell++) {
+        m_CellStart[cell + 1] += m_CellStart[cell];
+    }
+
+    int entries = m_CellStart[cellCount];
+    m_EntryX.resize(entries);
+    m_EntryY.resize(entries);
+    m_EntryRadius.resize(entries);
+    m_EntryId.resize(entries);
+    m_FillCursor.assign(m_CellStart.begin(), m_CellStart.end() - 1);
+    for (int id = 0; id < colliders.size(); id++) {
+        cellRange(colliders.x(id), colliders.y(id), colliders.radius(id), x0, y0, x1, y1);
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                int entry = m_FillCursor[y * m_Columns + x]++;
+                m_EntryX[entry] = colliders.x(id);
+                m_EntryY[entry] = colliders.y(id);
+                m_EntryRadius[entry] = colliders.radius(id);
+                m_EntryId[entry] = id;
+            }
+        }
+    }
+
+    if (m_QueryStamp.size() < (size_t)colliders.size()) {
+        m_QueryStamp.resize(colliders.size(), m_QueryId);
+    }
+}
+
+void SpatialHash::query(float x, float y, float radius, std::vector<int>& ids) {
+    ids.clear();
+    if (++m_QueryId == 0) {
+        // Stamp counter wrapped; forget every old stamp so none can match the new id by accident
+        std::fill(m_QueryStamp.begin(), m_QueryStamp.end(), 0);
+        m_QueryId = 1;
+    }
+
+    int x0, y0, x1, y1;
+    cellRange(x, y, radius, x0, y0, x1, y1);
+    for (int cy = y0; cy <= y1; cy++) {
+        for (int cx = x0; cx <= x1; cx++) {
+            int cell = cy * m_Columns + cx;
+            for (int first = m_CellStart[cell]; first < m_CellStart[cell + 1]; first += 32) {
+                int count = std::min(32, m_CellStart[cell + 1] - first);
+                uint32_t hits = CircleOverlapMask(x, y, radius, &m_EntryX[first], &m_EntryY[first],
+                                                  &m_EntryRadius[first], count);
+                while (hits) {
+                    int lane = 0;
+                    while (!(hits & (1u << lane))) {
+                        lane++;
+                    }
+                    hits &= hits - 1;
+
+                    int id = m_EntryId[first + lane];
+                    if (m_QueryStamp[id] != m_QueryId) {
+                        m_QueryStamp[id] = m_QueryId;
+                        ids.push_back(id);
+                    }
+                }
+            }
+        }
+    }
+
+    // Ids are insertion order, which callers use as their resolution priority
+    std::sort(ids.begin(), ids.end());
+}
+
+void SpatialHash::cellRange(float x, float y, float radius, int& x0, int& y0, int& x1, int& y1) const {
+    x0 = std::clamp((int)std::floor((x - radius) * m_InvCellSize), 0, m_Columns - 1);
+    y0 = std::clamp((int)std::floor((y - radius) * m_InvCellSize), 0, m_Rows - 1);
+    x1 = std::clamp((int)std::floor((x + radius) * m_InvCellSize), 0, m_Columns - 1);
+    y1 = std::clamp((int)std::floor((y + radius) * m_InvCellSize), 0, m_Rows - 1);
+}
+
+} // namespace omegarace
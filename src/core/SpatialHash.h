@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ColliderTable.h"
+#include <cstdint>
+#include <vector>
+
+namespace omegarace {
+
+// Uniform-grid broad phase over the arena, rebuilt every tick from the ColliderTable. Each collider
+// is copied into every cell its bounding box touches, with the cells' circles laid out back to
+// back, so a query runs CircleOverlapMask over a few short contiguous runs instead of over every
+// collidable in the wave. Positions outside the arena clamp to the edge cells.
+class SpatialHash {
+  public:
+    SpatialHash(float width, float height, float cellSize);
+
+    void build(const ColliderTable& colliders);
+
+    // Ids of the colliders that overlap the circle, each once, in ascending order
+    void query(float x, float y, float radius, std::vector<int>& ids);
+
+  private:
+    void cellRange(float x, float y, float radius, int& x0, int& y0, int& x1, int& y1) const;
+
+    float m_InvCellSize;
+    int m_Columns;
+    int m_Rows;
+
+    // Cell c's circles are entries m_CellStart[c] .. m_CellStart[c + 1] of the arrays below
+    std::vector<int> m_CellStart;
+    std::vector<int> m_FillCursor;
+    std::vector<float> m_EntryX;
+    std::vector<float> m_EntryY;
+    std::vector<float> m_EntryRadius;
+    std::vector<int> m_EntryId;
+
+    // Query deduplication: a collider filed in several cells is reported once per query
+    std::vector<uint32_t> m_QueryStamp;
+    uint32_t m_QueryId;
+};
+
+} // namespace omegarace
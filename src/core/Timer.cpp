@@ -1,15 +1,16 @@
 #include "Timer.h"
+#include "SimClock.h"
 
 namespace omegarace {
 
-Timer::Timer() : mStartTime(), mPausedDuration(0.0), mStarted(false), mPaused(false) {
+Timer::Timer() : mStartTime(0.0), mPausedDuration(0.0), mStarted(false), mPaused(false) {
 }
 
 void Timer::start() {
     mStarted = true;
     mPaused = false;
-    mStartTime = std::chrono::high_resolution_clock::now();
-    mPausedDuration = std::chrono::duration<double>(0.0);
+    mStartTime = SimClock::Seconds();
+    mPausedDuration = 0.0;
 }
 
 void Timer::stop() {
@@ -20,18 +21,15 @@ void Timer::stop() {
 void Timer::pause() {
     if (mStarted && !mPaused) {
         mPaused = true;
-        auto currentTime = std::chrono::high_resolution_clock::now();
-        mPausedDuration = std::chrono::duration_cast<std::chrono::duration<double>>(currentTime - mStartTime);
+        mPausedDuration = SimClock::Seconds() - mStartTime;
     }
 }
 
 void Timer::unpause() {
     if (mPaused) {
         mPaused = false;
-        auto currentTime = std::chrono::high_resolution_clock::now();
-        mStartTime =
-            currentTime - std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(mPausedDuration);
-        mPausedDuration = std::chrono::duration<double>(0.0);
+        mStartTime = SimClock::Seconds() - mPausedDuration;
+        mPausedDuration = 0.0;
     }
 }
 
@@ -42,27 +40,15 @@ int Timer::restart() {
 }
 
 int Timer::ticks() const {
-    if (mStarted) {
-        if (mPaused) {
-            return static_cast<int>(mPausedDuration.count() * 1000.0); // Convert seconds to milliseconds
-        } else {
-            auto currentTime = std::chrono::high_resolution_clock::now();
-            auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(currentTime - mStartTime);
-            return static_cast<int>(elapsed.count() * 1000.0); // Convert seconds to milliseconds
-        }
-    }
-    return 0;
+    return static_cast<int>(seconds() * 1000.0); // Convert seconds to milliseconds
 }
 
 double Timer::seconds() const {
     if (mStarted) {
         if (mPaused) {
-            return mPausedDuration.count();
-        } else {
-            auto currentTime = std::chrono::high_resolution_clock::now();
-            auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(currentTime - mStartTime);
-            return elapsed.count();
+            return mPausedDuration;
         }
+        return SimClock::Seconds() - mStartTime;
     }
     return 0.0;
 }
@@ -1,9 +1,8 @@
 #pragma once
 
-#include <chrono>
-
 namespace omegarace {
 
+// Stopwatch over the simulation clock (see SimClock); it never reads the OS clock
 class Timer {
   public:
     Timer();
@@ -18,8 +17,8 @@ class Timer {
     bool paused() const;
 
   private:
-    std::chrono::high_resolution_clock::time_point mStartTime;
-    std::chrono::duration<double> mPausedDuration;
+    double mStartTime;
+    double mPausedDuration;
     bool mStarted;
     bool mPaused;
 };
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+
+namespace omegarace {
+
+// Lock-free hand-off of whole values from one producer thread to one consumer thread. The producer
+// fills writeBuffer() and publishes it; the consumer acquires the newest published value and reads it
+// for as long as it likes. Neither side ever waits, and a value the consumer holds is never written.
+template <typename T>
+class TripleBuffer {
+  public:
+    T& writeBuffer() { return m_Slots[m_Back]; }
+
+    void publish() { m_Back = m_Middle.exchange(m_Back | FRESH, std::memory_order_acq_rel) & INDEX; }
+
+    // Moves to the newest published value; false (keeping the current one) if nothing new was published
+    bool acquire() {
+        if (!(m_Middle.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+        m_Front = m_Middle.exchange(m_Front, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    const T& readBuffer() const { return m_Slots[m_Front]; }
+
+  private:
+    static constexpr int INDEX = 3;
+    static constexpr int FRESH = 4; // Set on the middle slot between a publish and the next acquire
+
+    T m_Slots[3];
+    int m_Back = 0;  // Producer only
+    int m_Front = 1; // Consumer only
+    std::atomic<int> m_Middle{2};
+};
+
+} // namespace omegarace
@@ -24,6 +24,7 @@ void DoubleMine::draw() {
 void DoubleMine::mineDropped(const Vector2f& location) {
     m_Location = location;
     m_Active = true;
+    pMine->clearVaporTrail(); // Pooled mines are reused; drop the trail from the last drop
     m_Radius = m_Scale * 3; // Increased hit detection radius for easier shooting (was m_Scale * 2)
 }
 
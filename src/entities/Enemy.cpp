@@ -1,4 +1,5 @@
 #include "Enemy.h"
+#include "Random.h"
 
 namespace omegarace {
 
@@ -50,9 +51,9 @@ void Enemy::setTurns(WhenToTurn turns) {
 }
 
 void Enemy::setTurns() {
-    m_WhenToTurn.left = Window::Random(25, int(Window::GetWindowSize().x * 0.15625f) - 8);
-    m_WhenToTurn.right = Window::Random(int(Window::GetWindowSize().x * 0.84375f) + 8, Window::GetWindowSize().x - 25);
-    m_WhenToTurn.top = Window::Random(25, int(Window::GetWindowSize().y * 0.3335f));
+    m_WhenToTurn.left = Random::Int(Random::STREAM_AI, 25, int(Window::GetWindowSize().x * 0.15625f) - 8);
+    m_WhenToTurn.right = Random::Int(Random::STREAM_AI, int(Window::GetWindowSize().x * 0.84375f) + 8, Window::GetWindowSize().x - 25);
+    m_WhenToTurn.top = Random::Int(Random::STREAM_AI, 25, int(Window::GetWindowSize().y * 0.3335f));
     m_WhenToTurn.bottom = m_Location.y;
 }
 
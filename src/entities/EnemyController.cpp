@@ -1,7 +1,15 @@
 #include "EnemyController.h"
+#include "Jobs.h"
+#include "Random.h"
 
 namespace omegarace {
 
+namespace {
+
+const int SHIPS_PER_JOB = 8;
+
+} // namespace
+
 EnemyController::EnemyController() {
     pTimer = std::make_unique<Timer>();
     pTimer->start();
@@ -18,8 +26,29 @@ EnemyController::~EnemyController() {
 void EnemyController::update(double frame) {
     m_Frame = frame;
 
-    for (int ship = 0; ship < m_EnemyShips.size(); ship++) {
-        m_EnemyShips[ship]->update(frame);
+    // Wave ships only touch their own movement, trail and explosion, so they update across the job
+    // workers. Finished explosions are read back afterwards in set order, the same as a serial pass.
+    m_ShipsToUpdate.clear();
+    for (int live = 0; live < m_LiveShips.size(); live++) {
+        m_ShipsToUpdate.push_back(m_LiveShips[live]);
+    }
+    for (int exploding = 0; exploding < m_ExplodingShips.size(); exploding++) {
+        if (!m_LiveShips.contains(m_ExplodingShips[exploding])) {
+            m_ShipsToUpdate.push_back(m_ExplodingShips[exploding]);
+        }
+    }
+
+    Jobs::ParallelFor((int)m_ShipsToUpdate.size(), SHIPS_PER_JOB, [this, frame](int begin, int end) {
+        for (int ship = begin; ship < end; ship++) {
+            m_EnemyShips[m_ShipsToUpdate[ship]]->update(frame);
+        }
+    });
+
+    for (int exploding = m_ExplodingShips.size() - 1; exploding >= 0; exploding--) {
+        int ship = m_ExplodingShips[exploding];
+        if (!m_EnemyShips[ship]->getExplosionActive()) {
+            m_ExplodingShips.erase(ship);
+        }
     }
 
     pLeadEnemyShip->update(frame);
@@ -30,8 +59,13 @@ void EnemyController::update(double frame) {
 }
 
 void EnemyController::draw() {
-    for (int ship = 0; ship < m_EnemyShips.size(); ship++) {
-        m_EnemyShips[ship]->draw();
+    for (int live = 0; live < m_LiveShips.size(); live++) {
+        m_EnemyShips[m_LiveShips[live]]->draw();
+    }
+    for (int exploding = 0; exploding < m_ExplodingShips.size(); exploding++) {
+        if (!m_LiveShips.contains(m_ExplodingShips[exploding])) {
+            m_EnemyShips[m_ExplodingShips[exploding]]->draw();
+        }
     }
 
     pLeadEnemyShip->draw();
@@ -42,6 +76,8 @@ void EnemyController::draw() {
 int EnemyController::newGame() {
     m_FollowActive = false;
     m_EnemyShips.clear();
+    m_LiveShips = IndexSet();
+    m_ExplodingShips = IndexSet();
     m_NumberOfShips = 5;
     m_EnemySpeed = 10;
     pFollowEnemyShip->newGame();
@@ -71,10 +107,8 @@ int EnemyController::newWave() {
 }
 
 bool EnemyController::checkEndOfWave() {
-    for (int ship = 0; ship < m_EnemyShips.size(); ship++) {
-        if (m_EnemyShips[ship]->getActive())
-            return false;
-    }
+    if (!m_LiveShips.empty())
+        return false;
 
     if (pFollowEnemyShip->getActive())
         return false;
@@ -89,13 +123,10 @@ bool EnemyController::checkEndOfWave() {
 }
 
 int EnemyController::restartWave() {
-    int activeCount = 0;
+    int activeCount = m_LiveShips.size();
 
-    for (int ship = 0; ship < m_EnemyShips.size(); ship++) {
-        if (m_EnemyShips[ship]->getActive()) {
-            activeCount++;
-            m_EnemyShips[ship]->setActive(false);
-        }
+    while (!m_LiveShips.empty()) {
+        retireShip(m_LiveShips[0]);
     }
 
     if (pFighter->getActive()) {
@@ -125,26 +156,19 @@ void EnemyController::spawnNewWave(bool rightSide, int numberOfShips) {
     m_RightSide = rightSide;
 
     for (int ship = 0; ship < numberOfShips; ship++) {
-        bool spawnNewShip = true;
-
-        for (int shipCheck = 0; shipCheck < m_EnemyShips.size(); shipCheck++) {
-            if (!m_EnemyShips[shipCheck]->getActive()) {
-                spawnNewShip = false;
-                spawnShip(shipCheck);
-                break;
-            }
-        }
-
-        if (spawnNewShip) {
+        // Reuse a ship that isn't flying, building one only when every ship is
+        if (m_LiveShips.size() == (int)m_EnemyShips.size()) {
             m_EnemyShips.push_back(std::make_unique<Enemy>());
-            m_EnemyShips[m_EnemyShips.size() - 1]->initialize();
-            spawnShip((int)m_EnemyShips.size() - 1);
+            m_EnemyShips.back()->initialize();
+            m_LiveShips.grow((int)m_EnemyShips.size());
+            m_ExplodingShips.grow((int)m_EnemyShips.size());
         }
+        spawnShip(m_LiveShips.outsider(0));
     }
 
     Vector2i spawnPoint;
 
-    spawnPoint.y = Window::Random(Window::GetWindowSize().y * 0.5f + int(Window::GetWindowSize().y * 0.125f) + 25,
+    spawnPoint.y = Random::Int(Random::STREAM_WAVES, Window::GetWindowSize().y * 0.5f + int(Window::GetWindowSize().y * 0.125f) + 25,
                                   Window::GetWindowSize().y - 25);
 
     if (m_RightSide)
@@ -171,13 +195,13 @@ void EnemyController::spawnNewWave(bool rightSide, int numberOfShips) {
 void EnemyController::spawnShip(int ship) {
     Vector2i spawnPoint;
 
-    spawnPoint.y = Window::Random(Window::GetWindowSize().y * 0.5f + int(Window::GetWindowSize().y * 0.125f) + 25,
+    spawnPoint.y = Random::Int(Random::STREAM_WAVES, Window::GetWindowSize().y * 0.5f + int(Window::GetWindowSize().y * 0.125f) + 25,
                                   Window::GetWindowSize().y - 25);
 
     if (m_RightSide) {
-        spawnPoint.x = Window::Random(Window::GetWindowSize().x * 0.5f, Window::GetWindowSize().x - 105);
+        spawnPoint.x = Random::Int(Random::STREAM_WAVES, Window::GetWindowSize().x * 0.5f, Window::GetWindowSize().x - 105);
     } else {
-        spawnPoint.x = Window::Random(105, Window::GetWindowSize().x / 2);
+        spawnPoint.x = Random::Int(Random::STREAM_WAVES, 105, Window::GetWindowSize().x / 2);
     }
 
     m_EnemyShips[ship]->setLocation(spawnPoint);
@@ -187,6 +211,12 @@ void EnemyController::spawnShip(int ship) {
     m_EnemyShips[ship]->startMoving();
     m_EnemyShips[ship]->setTurns();
     m_EnemyShips[ship]->setActive(true);
+    m_LiveShips.insert(ship);
+}
+
+void EnemyController::retireShip(int ship) {
+    m_EnemyShips[ship]->setActive(false);
+    m_LiveShips.erase(ship);
 }
 
 float EnemyController::getEnemyRadius() {
@@ -194,7 +224,11 @@ float EnemyController::getEnemyRadius() {
 }
 
 int EnemyController::getEnemyCount() {
-    return (int)m_EnemyShips.size();
+    return m_LiveShips.size();
+}
+
+int EnemyController::getLiveEnemy(int live) {
+    return m_LiveShips[live];
 }
 
 Vector2f EnemyController::getEnemyLocaiton(int ship) {
@@ -207,7 +241,8 @@ bool EnemyController::getEnemyCircle(const Vector2f& location, float radius, int
 
 void EnemyController::enemyHit(int ship) {
     m_EnemyShips[ship]->explode();
-    m_EnemyShips[ship]->setActive(false);
+    retireShip(ship);
+    m_ExplodingShips.insert(ship);
 }
 
 bool EnemyController::getEnemyActive(int ship) {
@@ -228,7 +263,7 @@ void EnemyController::leadEnemyHit() {
         Vector2f newVelocity = m_EnemyShips[ship]->getVelocity() * 1.5;
         pLeadEnemyShip->setVelocity(newVelocity);
         pLeadEnemyShip->setTurns(m_EnemyShips[ship]->getTurns());
-        m_EnemyShips[ship]->setActive(false);
+        retireShip(ship);
     } else if (pFollowEnemyShip->getActive()) {
         pLeadEnemyShip->setLocation(pFollowEnemyShip->getLocation());
         Vector2f newVelocity = pFollowEnemyShip->getVelocity() * 1.5;
@@ -257,7 +292,7 @@ void EnemyController::placeFollowEnemy(int ship) {
     pFollowEnemyShip->setSpeed(m_EnemySpeed);
     pFollowEnemyShip->setRightSide(m_RightSide);
     pFollowEnemyShip->setTurns(m_EnemyShips[ship]->getTurns());
-    m_EnemyShips[ship]->setActive(false);
+    retireShip(ship);
 }
 
 void EnemyController::checkFighterTimer() {
@@ -270,14 +305,14 @@ void EnemyController::checkFighterTimer() {
 }
 
 void EnemyController::resetFighterTimer() {
-    m_FighterTimer = m_FighterTimerAmount + Window::Random(0, m_FighterTimerAmount) + pTimer->seconds();
+    m_FighterTimer = m_FighterTimerAmount + Random::Int(Random::STREAM_WAVES, 0, m_FighterTimerAmount) + pTimer->seconds();
 }
 
 void EnemyController::launchFighter() {
     if (enemyLeft()) {
         int ship = findEnemy();
         pFighter->start(m_EnemyShips[ship]->getLocation(), m_EnemyShips[ship]->getVelocity());
-        m_EnemyShips[ship]->setActive(false);
+        retireShip(ship);
     } else if (pFollowEnemyShip->getActive()) {
         pFighter->start(pFollowEnemyShip->getLocation(), pFollowEnemyShip->getVelocity());
         pFollowEnemyShip->setActive(false);
@@ -288,25 +323,12 @@ void EnemyController::launchFighter() {
 }
 
 bool EnemyController::enemyLeft() {
-    for (int ship = 0; ship < m_EnemyShips.size(); ship++) {
-        if (m_EnemyShips[ship]->getActive()) {
-            return true;
-        }
-    }
-
-    return false;
+    return !m_LiveShips.empty();
 }
 
+// Only called when enemyLeft()
 int EnemyController::findEnemy() {
-    bool shipActive = false;
-    int ship = 0;
-
-    while (!shipActive) {
-        ship = Window::Random(0, (int)m_EnemyShips.size() - 1);
-        shipActive = m_EnemyShips[ship]->getActive();
-    }
-
-    return ship;
+    return m_LiveShips[Random::Int(Random::STREAM_WAVES, 0, m_LiveShips.size() - 1)];
 }
 
 Fighter* EnemyController::getFighterPointer() {
@@ -321,20 +343,6 @@ LeadEnemy* EnemyController::getLeadPointer() {
     return pLeadEnemyShip.get();
 }
 
-void EnemyController::timerPause() {
-    pTimer->pause();
-    pFighter->timerPause();
-    pFollowEnemyShip->timerPause();
-    pLeadEnemyShip->timerPause();
-}
-
-void EnemyController::timerUnpause() {
-    pTimer->unpause();
-    pFighter->timerUnpause();
-    pFollowEnemyShip->timerUnpause();
-    pLeadEnemyShip->timerUnpause();
-}
-
 bool EnemyController::checkExploding() {
     bool explodeing = false;
 
@@ -4,6 +4,7 @@
 #include "Enemy.h"
 #include "Fighter.h"
 #include "FollowEnemy.h"
+#include "IndexSet.h"
 #include "LeadEnemy.h"
 #include "Timer.h"
 #include <vector>
@@ -29,8 +30,6 @@ class EnemyController : public Common {
     void followEnemyHit();
     void resumeWave();
     void setInisdeBorder(const SDL_Rect& border);
-    void timerPause();
-    void timerUnpause();
     void setPlayerPosition(const Vector2f& playerPos);
     void clearAllVaporTrails(); // NEW: Clear all enemy vapor trails
     bool checkEndOfWave();
@@ -40,11 +39,14 @@ class EnemyController : public Common {
     int newGame();
     int newWave();
     int restartWave();
+    // Live ships are walked with getLiveEnemy(0..getEnemyCount()-1), which gives their ship numbers
     int getEnemyCount();
+    int getLiveEnemy(int live);
     float getEnemyRadius();
 
   private:
     void spawnShip(int ship);
+    void retireShip(int ship);
     void placeFollowEnemy(int ship);
     void checkFighterTimer();
     void resetFighterTimer();
@@ -65,6 +67,9 @@ class EnemyController : public Common {
     std::unique_ptr<FollowEnemy> pFollowEnemyShip;
     std::unique_ptr<Fighter> pFighter;
     std::vector<std::unique_ptr<Enemy>> m_EnemyShips;
+    IndexSet m_LiveShips;      // Flying ships; everything else is free for the next spawn
+    IndexSet m_ExplodingShips; // Shot-down ships whose explosion is still playing
+    std::vector<int> m_ShipsToUpdate; // This tick's live and exploding ships, in set order
 };
 
 } // namespace omegarace
@@ -1,4 +1,5 @@
 #include "Fighter.h"
+#include "Random.h"
 
 namespace omegarace {
 
@@ -12,7 +13,6 @@ void Fighter::update(double Frame) {
         checkBorders();
     }
 
-    pShot->update(Frame);
     pExplosion->update(Frame);
 }
 
@@ -22,11 +22,11 @@ void Fighter::draw() {
         pBlade->draw();
     }
 
-    pShot->draw();
     pExplosion->draw();
 
-    for (int mine = 0; mine < m_Mines.size(); mine++)
-        m_Mines[mine]->draw();
+    for (int mine = 0; mine < m_Mines.size(); mine++) {
+        m_Mines.at(m_Mines.liveSlot(mine))->draw();
+    }
 }
 
 void Fighter::setPlayerLocation(const Vector2f& location) {
@@ -35,7 +35,7 @@ void Fighter::setPlayerLocation(const Vector2f& location) {
 
 void Fighter::setInsideBorder(const SDL_Rect& border) {
     m_InsideBorder = border;
-    pShot->setInsideBorder(border);
+    Projectiles::SetInsideBorder(border);
 }
 
 bool Fighter::getInsideLineHit(int line) {
@@ -46,40 +46,47 @@ bool Fighter::getOutsideLineHit(int line) {
     return m_OutsideLineHit[line];
 }
 
-Vector2f Fighter::getMineLocaiton(int mine) {
-    return m_Mines[mine]->getLocation();
+int Fighter::getMineCount() {
+    return m_Mines.size();
 }
 
-float Fighter::getMineRadius() {
-    return m_Mines[0]->getRadius();
+PoolHandle Fighter::getMineHandle(int mine) {
+    return m_Mines.handleAt(m_Mines.liveSlot(mine));
 }
 
-int Fighter::getMineCount() {
-    return (int)m_Mines.size();
+Vector2f Fighter::getMineLocaiton(PoolHandle mine) {
+    return m_Mines.get(mine)->getLocation();
 }
 
-bool Fighter::getMineActive(int mine) {
-    return m_Mines[mine]->getActive();
+float Fighter::getMineRadius(PoolHandle mine) {
+    return m_Mines.get(mine)->getRadius();
 }
 
-void Fighter::mineHit(int mine) {
-    m_Mines[mine]->setActive(false);
+bool Fighter::getMineActive(PoolHandle mine) {
+    return m_Mines.get(mine) && m_Mines.get(mine)->getActive();
+}
+
+void Fighter::mineHit(PoolHandle mine) {
+    if (m_Mines.get(mine)) {
+        m_Mines.get(mine)->setActive(false);
+        m_Mines.release(mine);
+    }
 }
 
 Vector2f Fighter::getShotLocation() {
-    return pShot->getLocation();
+    return Projectiles::Location(m_Shot);
 }
 
 float Fighter::getShotRadius() {
-    return pShot->getRadius();
+    return Projectiles::RADIUS;
 }
 
 bool Fighter::getShotActive() {
-    return pShot->getActive();
+    return Projectiles::Active(m_Shot);
 }
 
 void Fighter::shotHitTarget() {
-    pShot->setActive(false);
+    Projectiles::Retire(m_Shot);
 }
 
 void Fighter::start(const Vector2f& location, const Vector2f& velocity) {
@@ -106,14 +113,6 @@ void Fighter::newGame() {
     m_Active = false;
 }
 
-void Fighter::timerPause() {
-    pTimer->pause();
-}
-
-void Fighter::timerUnpause() {
-    pTimer->unpause();
-}
-
 void Fighter::explode() {
     m_Active = false;
     pExplosion->activate(m_Location, 2);
@@ -125,7 +124,6 @@ bool Fighter::getExplosionActive() {
 
 Fighter::Fighter() {
     pShip = std::make_unique<TriShip>();
-    pShot = std::make_unique<Shot>();
     pBlade = std::make_unique<FighterShip>();
     pExplosion = std::make_unique<Explosion>();
     pTimer = std::make_unique<Timer>();
@@ -143,15 +141,15 @@ Fighter::~Fighter() {
 }
 
 void Fighter::resetMineTimer() {
-    m_MineTimer = m_MineTimerAmount + Window::Random(0, m_MineTimerAmount) + pTimer->seconds();
+    m_MineTimer = m_MineTimerAmount + Random::Int(Random::STREAM_AI, 0, m_MineTimerAmount) + pTimer->seconds();
 }
 
 void Fighter::resetShotTimer() {
-    m_ShotTimer = m_ShotTimerAmount + Window::Random(0, m_ShotTimerAmount) + pTimer->seconds();
+    m_ShotTimer = m_ShotTimerAmount + Random::Int(Random::STREAM_AI, 0, m_ShotTimerAmount) + pTimer->seconds();
 }
 
 void Fighter::resetChangeVectorTimer() {
-    m_ChangeVectorTimer = m_ChangeVectorTimerAmount + Window::Random(0, m_ChangeVectorTimerAmount) + pTimer->seconds();
+    m_ChangeVectorTimer = m_ChangeVectorTimerAmount + Random::Int(Random::STREAM_AI, 0, m_ChangeVectorTimerAmount) + pTimer->seconds();
 }
 
 void Fighter::timerCheck() {
@@ -173,24 +171,27 @@ void Fighter::timerCheck() {
 
 void Fighter::layMine() {
     float scale = 3.5;
-    m_Mines.push_back(std::make_unique<DoubleMine>());
-    int mine = (int)m_Mines.size() - 1;
-    m_Mines[mine]->initialize();
-    m_Mines[mine]->setScale(scale);
-    m_Mines[mine]->mineDropped(m_Location);
+    DoubleMine* mine = m_Mines.get(m_Mines.acquire());
+    if (!mine) {
+        return; // Every mine slot is out; skip this drop
+    }
+    mine->initialize();
+    mine->setScale(scale);
+    mine->mineDropped(m_Location);
 }
 
 void Fighter::shotPlayer() {
     float angle = atan2(m_PlayerLocation.y - m_Location.y, m_PlayerLocation.x - m_Location.x);
-    pShot->activate(m_Location, angle);
+    Projectiles::Retire(m_Shot); // One shot at a time; firing again re-aims it
+    m_Shot = Projectiles::Fire(Projectiles::OWNER_FIGHTER, m_Location, angle);
     resetShotTimer();
 }
 
 void Fighter::changeVector() {
     float angle;
 
-    if (Window::Random(0, 2)) {
-        angle = Window::Random(0, (Pi * 2) * 10) * 0.1;
+    if (Random::Int(Random::STREAM_AI, 0, 2)) {
+        angle = Random::Int(Random::STREAM_AI, 0, (Pi * 2) * 10) * 0.1;
     } else {
         angle = atan2(m_PlayerLocation.y - m_Location.y, m_PlayerLocation.x - m_Location.x);
     }
@@ -4,7 +4,8 @@
 #include "Entity.h"
 #include "Explosion.h"
 #include "FighterShip.h"
-#include "Shot.h"
+#include "Pool.h"
+#include "Projectiles.h"
 #include "Timer.h"
 #include "TriShip.h"
 
@@ -21,19 +22,20 @@ class Fighter : public Entity {
     void setInsideBorder(const SDL_Rect& border);
     bool getInsideLineHit(int line);
     bool getOutsideLineHit(int line);
-    Vector2f getMineLocaiton(int mine);
-    float getMineRadius();
+    // Live mines are walked with getMineHandle(0..getMineCount()-1); mineHit moves the last live
+    // mine into the gap, so walk backwards when hitting as you go
     int getMineCount();
-    bool getMineActive(int mine);
-    void mineHit(int mine);
+    PoolHandle getMineHandle(int mine);
+    Vector2f getMineLocaiton(PoolHandle mine);
+    float getMineRadius(PoolHandle mine);
+    bool getMineActive(PoolHandle mine);
+    void mineHit(PoolHandle mine);
     Vector2f getShotLocation();
     void shotHitTarget();
     float getShotRadius();
     bool getShotActive();
     void newGame();
     void start(const Vector2f& location, const Vector2f& velocity);
-    void timerPause();
-    void timerUnpause();
     void explode();
     bool getExplosionActive();
     void clearVaporTrail(); // NEW: Clear vapor trail
@@ -50,10 +52,11 @@ class Fighter : public Entity {
 
     std::unique_ptr<Timer> pTimer;
     std::unique_ptr<TriShip> pShip;
-    std::unique_ptr<Shot> pShot;
+    PoolHandle m_Shot;
     std::unique_ptr<FighterShip> pBlade;
     std::unique_ptr<Explosion> pExplosion;
-    std::vector<std::unique_ptr<DoubleMine>> m_Mines;
+    static constexpr int MAX_MINES = 32;
+    Pool<DoubleMine, MAX_MINES> m_Mines;
 
     Vector2f m_PlayerLocation;
     SDL_Rect m_InsideBorder;
@@ -1,4 +1,5 @@
 #include "FollowEnemy.h"
+#include "Random.h"
 #include <cmath>
 
 namespace omegarace {
@@ -41,7 +42,7 @@ void FollowEnemy::draw() {
     }
 
     for (int mine = 0; mine < m_Mines.size(); mine++) {
-        m_Mines[mine]->draw();
+        m_Mines.at(m_Mines.liveSlot(mine))->draw();
     }
 }
 
@@ -81,32 +82,31 @@ void FollowEnemy::newGame() {
     m_Active = false;
 }
 
-Vector2f FollowEnemy::getMineLocaiton(int mine) {
-    return m_Mines[mine]->getLocation();
-}
-
-float FollowEnemy::getMineRadius() {
-    return m_Mines[0]->getRadius();
+int FollowEnemy::getMineCount() {
+    return m_Mines.size();
 }
 
-int FollowEnemy::getMineCount() {
-    return (int)m_Mines.size();
+PoolHandle FollowEnemy::getMineHandle(int mine) {
+    return m_Mines.handleAt(m_Mines.liveSlot(mine));
 }
 
-bool FollowEnemy::getMineActive(int mine) {
-    return m_Mines[mine]->getActive();
+Vector2f FollowEnemy::getMineLocaiton(PoolHandle mine) {
+    return m_Mines.get(mine)->getLocation();
 }
 
-void FollowEnemy::mineHit(int mine) {
-    m_Mines[mine]->setActive(false);
+float FollowEnemy::getMineRadius(PoolHandle mine) {
+    return m_Mines.get(mine)->getRadius();
 }
 
-void FollowEnemy::timerPause() {
-    pTimer->pause();
+bool FollowEnemy::getMineActive(PoolHandle mine) {
+    return m_Mines.get(mine) && m_Mines.get(mine)->getActive();
 }
 
-void FollowEnemy::timerUnpause() {
-    pTimer->unpause();
+void FollowEnemy::mineHit(PoolHandle mine) {
+    if (m_Mines.get(mine)) {
+        m_Mines.get(mine)->setActive(false);
+        m_Mines.release(mine);
+    }
 }
 
 void FollowEnemy::clearVaporTrail() {
@@ -121,11 +121,13 @@ void FollowEnemy::clearVaporTrail() {
 
 void FollowEnemy::spawnMine() {
     float scale = 3.5;
-    m_Mines.push_back(std::make_unique<Mine>());
-    int mine = (int)m_Mines.size() - 1;
-    m_Mines[mine]->setLocation(m_Location);
-    m_Mines[mine]->setScale(scale);
-    m_Mines[mine]->mineDropped();
+    Mine* mine = m_Mines.get(m_Mines.acquire());
+    if (!mine) {
+        return; // Every mine slot is out; skip this drop
+    }
+    mine->setLocation(m_Location);
+    mine->setScale(scale);
+    mine->mineDropped();
 }
 
 void FollowEnemy::timeToLayMine() {
@@ -136,7 +138,7 @@ void FollowEnemy::timeToLayMine() {
 }
 
 void FollowEnemy::resetTimer() {
-    m_MineTimer = m_MineTimerAmount + Window::Random(0, m_MineTimerAmount) + pTimer->seconds();
+    m_MineTimer = m_MineTimerAmount + Random::Int(Random::STREAM_AI, 0, m_MineTimerAmount) + pTimer->seconds();
 }
 
 } // namespace omegarace
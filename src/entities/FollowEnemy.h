@@ -2,6 +2,7 @@
 
 #include "Enemy.h"
 #include "Mine.h"
+#include "Pool.h"
 #include "Timer.h"
 #include "TriShip.h"
 
@@ -15,19 +16,21 @@ class FollowEnemy : public Enemy {
     void update(double Frame);
     void draw();
     void newGame();
-    Vector2f getMineLocaiton(int mine);
-    float getMineRadius();
+    // Live mines are walked with getMineHandle(0..getMineCount()-1); mineHit moves the last live
+    // mine into the gap, so walk backwards when hitting as you go
     int getMineCount();
-    bool getMineActive(int mine);
-    void mineHit(int mine);
-    void timerPause();
-    void timerUnpause();
+    PoolHandle getMineHandle(int mine);
+    Vector2f getMineLocaiton(PoolHandle mine);
+    float getMineRadius(PoolHandle mine);
+    bool getMineActive(PoolHandle mine);
+    void mineHit(PoolHandle mine);
     void setPlayerPosition(const Vector2f& playerPos);
     void clearVaporTrail(); // NEW: Clear TriShip vapor trail
 
   private:
     std::unique_ptr<TriShip> pTriShip;
-    std::vector<std::unique_ptr<Mine>> m_Mines;
+    static constexpr int MAX_MINES = 32;
+    Pool<Mine, MAX_MINES> m_Mines;
     std::unique_ptr<Timer> pTimer = nullptr;
 
     float m_MineTimer;
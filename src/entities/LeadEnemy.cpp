@@ -1,11 +1,11 @@
 #include "LeadEnemy.h"
+#include "Random.h"
 
 namespace omegarace {
 
 LeadEnemy::LeadEnemy() {
     m_FireTimerAmount = 2.8;
     pTriShip = std::make_unique<TriShip>();
-    pShot = std::make_unique<Shot>();
     pTimer = std::make_unique<Timer>();
     pTimer->start();
     resetShotTimer();
@@ -22,7 +22,6 @@ void LeadEnemy::update(double frame) {
     }
 
     Enemy::update(frame);
-    pShot->update(frame);
 }
 
 void LeadEnemy::draw() {
@@ -31,7 +30,6 @@ void LeadEnemy::draw() {
     }
 
     Enemy::draw();
-    pShot->draw();
 }
 
 void LeadEnemy::setPlayerLocation(const Vector2f& location) {
@@ -39,36 +37,29 @@ void LeadEnemy::setPlayerLocation(const Vector2f& location) {
 }
 
 void LeadEnemy::setInsideBorderOnShot(const SDL_Rect& border) {
-    pShot->setInsideBorder(border);
+    Projectiles::SetInsideBorder(border);
 }
 
 Vector2f LeadEnemy::getShotLocation() {
-    return pShot->getLocation();
+    return Projectiles::Location(m_Shot);
 }
 
 float LeadEnemy::getShotRadius() {
-    return pShot->getRadius();
+    return Projectiles::RADIUS;
 }
 
 bool LeadEnemy::getShotActive() {
-    return pShot->getActive();
+    return Projectiles::Active(m_Shot);
 }
 
 void LeadEnemy::shotHitTarget() {
-    pShot->setActive(false);
-}
-
-void LeadEnemy::timerPause() {
-    pTimer->pause();
-}
-
-void LeadEnemy::timerUnpause() {
-    pTimer->unpause();
+    Projectiles::Retire(m_Shot);
 }
 
 void LeadEnemy::fireShot() {
     float angle = atan2(m_PlayerLocation.y - m_Location.y, m_PlayerLocation.x - m_Location.x);
-    pShot->activate(m_Location, angle);
+    Projectiles::Retire(m_Shot); // One shot at a time; firing again re-aims it
+    m_Shot = Projectiles::Fire(Projectiles::OWNER_LEAD, m_Location, angle);
     resetShotTimer();
 }
 
@@ -78,7 +69,7 @@ void LeadEnemy::checkToFire() {
 }
 
 void LeadEnemy::resetShotTimer() {
-    m_FireTimer = m_FireTimerAmount + pTimer->seconds() + Window::Random(0, (int)(m_FireTimerAmount * 10) * 0.1);
+    m_FireTimer = m_FireTimerAmount + pTimer->seconds() + Random::Int(Random::STREAM_AI, 0, (int)(m_FireTimerAmount * 10) * 0.1);
 }
 
 void LeadEnemy::clearVaporTrail() {
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Enemy.h"
-#include "Shot.h"
+#include "Projectiles.h"
 #include "Timer.h"
 #include "TriShip.h"
 
@@ -20,8 +20,6 @@ class LeadEnemy : public Enemy {
     Vector2f getShotLocation();
     float getShotRadius();
     bool getShotActive();
-    void timerPause();
-    void timerUnpause();
     void clearVaporTrail(); // NEW: Clear vapor trail
 
   private:
@@ -34,7 +32,7 @@ class LeadEnemy : public Enemy {
     Vector2f m_PlayerLocation;
 
     std::unique_ptr<Timer> pTimer;
-    std::unique_ptr<Shot> pShot;
+    PoolHandle m_Shot;
     std::unique_ptr<TriShip> pTriShip;
 };
 
@@ -20,6 +20,7 @@ void Mine::draw() {
 }
 
 void Mine::mineDropped() {
+    pMine->clearVaporTrail(); // Pooled mines are reused; drop the trail from the last drop
     pMine->update(m_Location, m_Scale, m_Velocity);
     m_Active = true;
 }
@@ -1,5 +1,7 @@
 #include "Player.h"
 #include "../core/Logger.h"
+#include "../core/Platform.h"
+#include "../core/Random.h"
 
 namespace omegarace {
 
@@ -44,7 +46,6 @@ Player::Player() {
     ShipColor.blue = 0;
     ShipColor.alpha = 255;
 
-    initializeShot();
     pShip->initializeLines();
 }
 
@@ -52,11 +53,11 @@ Player::~Player() {
 }
 
 void Player::initialize() {
-    // Use static AudioEngine methods instead of instance methods
-    AudioEngine::LoadSound("PlayerShot");
-    // AudioEngine::LoadSound("Thrust");
-    // AudioEngine::LoadSound("PlayerHit");
-    // AudioEngine::LoadSound("BorderHit");
+    // Sounds go through whichever AudioOutput the platform bound
+    Platform::Audio().loadSound("PlayerShot");
+    // Platform::Audio().loadSound("Thrust");
+    // Platform::Audio().loadSound("PlayerHit");
+    // Platform::Audio().loadSound("BorderHit");
 }
 
 // Public Methods
@@ -73,13 +74,10 @@ void Player::draw() {
             drawThrust();
     } else if (m_ExplosionOn)
         pShip->drawExplosion();
-
-    drawShots();
 }
 
 void Player::update(double frame) {
     updateFrame(frame);
-    updateShots(frame);
 
     if (m_Active && !m_Hit) {
         // Only do edge detection if player has been properly spawned
@@ -103,26 +101,6 @@ void Player::fireButtonPressed() {
     }
 }
 
-int Player::getNumberOfShots() {
-    return m_NumberOfShots;
-}
-
-float Player::getShotRadius() {
-    return pShots[0]->getRadius();
-}
-
-Vector2i Player::getShotLocation(int Shot) {
-    return pShots[Shot]->getLocation();
-}
-
-bool Player::getShotActive(int Shot) {
-    return pShots[Shot]->getActive();
-}
-
-bool Player::getShotCircle(const Vector2f& location, float radius, int shot) {
-    return pShots[shot]->circlesIntersect(location, radius);
-}
-
 bool Player::getHit() {
     return m_Hit;
 }
@@ -131,10 +109,6 @@ bool Player::getExplosionOn() {
     return m_ExplosionOn;
 }
 
-void Player::setShotActive(int Shot, bool Active) {
-    pShots[Shot]->setActive(Active);
-}
-
 void Player::setThrust(bool Thrust) {
     m_Thrust = Thrust;
 }
@@ -159,7 +133,7 @@ void Player::restart() {
 void Player::hit() {
     if (!m_Hit) {
         // Play Player explosion sound.
-        AudioEngine::PlaySoundFile("PlayerHit");
+        Platform::Audio().playSound("PlayerHit");
 
         m_ExplosionOn = true;
         m_Hit = true;
@@ -167,16 +141,14 @@ void Player::hit() {
 
         // Turn off thrust sound.
         if (m_ThrustChannel != -1) {
-            AudioEngine::StopChannel(m_ThrustChannel);
+            Platform::Audio().stopChannel(m_ThrustChannel);
             m_ThrustChannel = -1;
         }
     }
 }
 
 void Player::spawn(bool rightSide) {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        pShots[shot]->setActive(false);
-    }
+    Projectiles::Clear(Projectiles::OWNER_PLAYER);
 
     if (rightSide) {
         m_Rotation.amount = 0;
@@ -198,28 +170,19 @@ void Player::spawn(bool rightSide) {
 
 void Player::setInsideBorder(const SDL_Rect& border) {
     m_InsideBorder = border;
-
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        pShots[shot]->setInsideBorder(m_InsideBorder);
-    }
+    Projectiles::SetInsideBorder(m_InsideBorder);
 }
 
 bool Player::getInsideLineHit(int line) {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        if (pShots[shot]->getInsideLine(line))
-            m_InsideLineHit[line] = true;
-
-        pShots[shot]->setInsideLine(line);
-    }
+    if (Projectiles::InsideLineHit(Projectiles::OWNER_PLAYER, line))
+        m_InsideLineHit[line] = true;
 
     return m_InsideLineHit[line];
 }
 
 bool Player::getOutsideLineHit(int line) {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        if (pShots[shot]->getOutsideLine(line))
-            m_OutsideLineHit[line] = true;
-    }
+    if (Projectiles::OutsideLineHit(Projectiles::OWNER_PLAYER, line))
+        m_OutsideLineHit[line] = true;
 
     return m_OutsideLineHit[line];
 }
@@ -230,29 +193,14 @@ Vector2f Player::getNosePosition() {
 }
 
 void Player::fireShot() {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        if (!pShots[shot]->getActive()) {
-            // If shot found that is not active, then activate that shot.
-            AudioEngine::PlaySoundFile("PlayerShot");
-            // Fire from nose position instead of center
-            Vector2f nosePos = getNosePosition();
-            pShots[shot]->activate(nosePos, m_Rotation.amount);
-            break;
+    if (Projectiles::Count(Projectiles::OWNER_PLAYER) < m_NumberOfShots) {
+        // Fire from nose position instead of center
+        if (Projectiles::Fire(Projectiles::OWNER_PLAYER, getNosePosition(), m_Rotation.amount).valid()) {
+            Platform::Audio().playSound("PlayerShot");
         }
     }
 }
 
-void Player::updateShots(double Frame) {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        pShots[shot]->update(Frame);
-    }
-}
-
-void Player::drawShots() {
-    for (int shot = 0; shot < m_NumberOfShots; shot++)
-        pShots[shot]->draw();
-}
-
 void Player::drawThrust() {
     if (pTimer->seconds() > m_ThrustDrawTimer) {
         m_ThrustDrawTimer = pTimer->seconds() + m_ThrustDrawTimerAmount;
@@ -261,16 +209,9 @@ void Player::drawThrust() {
     }
 }
 
-void Player::initializeShot() {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        pShots[shot] = std::make_unique<PlayerShot>();
-        pShots[shot]->setInsideBorder(m_InsideBorder);
-    }
-}
-
 void Player::updateEdge() {
     if (checkForXEdge()) {
-        AudioEngine::PlaySoundFile("BorderHit");
+        Platform::Audio().playSound("BorderHit");
         bounceX();
 
         if (m_Location.x > Window::GetWindowSize().x / 2) {
@@ -294,7 +235,7 @@ void Player::updateEdge() {
     }
 
     if (checkForYEdge()) {
-        AudioEngine::PlaySoundFile("BorderHit");
+        Platform::Audio().playSound("BorderHit");
         bounceY();
 
         if (m_Location.y > Window::GetWindowSize().y / 2) {
@@ -319,7 +260,7 @@ void Player::updateEdge() {
 
     if (rectangleIntersect(m_InsideBorder)) {
         Logger::Info("Intersect");
-        AudioEngine::PlaySoundFile("BorderHit");
+        Platform::Audio().playSound("BorderHit");
 
         int maxborder = m_InsideBorder.x + m_InsideBorder.w - 1;
         if (valueInRange(m_Location.x, m_InsideBorder.x, maxborder)) {
@@ -379,7 +320,7 @@ void Player::updateRotationThrust() {
     if (m_Thrust) {
         // Play thrust sound.
         if (m_ThrustChannel == -1) {
-            m_ThrustChannel = AudioEngine::PlaySoundFile("Thrust");
+            m_ThrustChannel = Platform::Audio().playSound("Thrust");
         }
 
         if (m_Velocity.x > m_MaxThrust)
@@ -399,7 +340,7 @@ void Player::updateRotationThrust() {
     } else {
         // Turn off thrust sound.
         if (m_ThrustChannel != -1) {
-            AudioEngine::StopChannel(m_ThrustChannel);
+            Platform::Audio().stopChannel(m_ThrustChannel);
             m_ThrustChannel = -1;
         }
 
@@ -410,19 +351,7 @@ void Player::updateRotationThrust() {
 void Player::setExplosion() {
     Vector2i location = m_Location;
     pShip->setExplosion(location);
-    m_ExplosionTimer = pTimer->seconds() + m_ExplosiontTimerAmount + Window::Random(0, (int)m_ExplosiontTimerAmount);
-}
-
-void Player::timerPause() {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        pShots[shot]->timerPause();
-    }
-}
-
-void Player::timerUnpause() {
-    for (int shot = 0; shot < m_NumberOfShots; shot++) {
-        pShots[shot]->timerUnpause();
-    }
+    m_ExplosionTimer = pTimer->seconds() + m_ExplosiontTimerAmount + Random::Int(Random::STREAM_WAVES, 0, (int)m_ExplosiontTimerAmount);
 }
 
 void Player::clearVaporTrail() {
@@ -1,9 +1,8 @@
 #pragma once
 
-#include "AudioEngine.h"
 #include "Entity.h"
 #include "PlayerShip.h"
-#include "PlayerShot.h"
+#include "Projectiles.h"
 #include "Timer.h"
 
 namespace omegarace {
@@ -24,15 +23,7 @@ class Player : public Entity {
     void setThrust(bool Thrust);
     void setTurnRight(bool TurnRight);
     void setTurnLeft(bool TurnLeft);
-    void setShotActive(int Shot, bool Active);
     void setInsideBorder(const SDL_Rect& border);
-    void timerPause();
-    void timerUnpause();
-    int getNumberOfShots();
-    float getShotRadius();
-    Vector2i getShotLocation(int Shot);
-    bool getShotActive(int Shot);
-    bool getShotCircle(const Vector2f& location, float radius, int shot);
     bool getHit();
     bool getExplosionOn();
     bool getInsideLineHit(int line);
@@ -44,11 +35,8 @@ class Player : public Entity {
 
   private:
     void updateShip();
-    void updateShots(double frame);
     void updateRotationThrust();
     void updateEdge();
-    void initializeShot();
-    void drawShots();
     void drawThrust();
     void fireShot();
     void setExplosion();
@@ -62,7 +50,7 @@ class Player : public Entity {
     bool m_HasBeenSpawned; // NEW: Track if player has been spawned yet
     bool m_InsideLineHit[4];
     bool m_OutsideLineHit[8];
-    int m_NumberOfShots;
+    int m_NumberOfShots; // most shots in flight at once
     float m_MaxThrust;
     float m_ThrustMagnitude;
     float m_TurnRate;
@@ -74,7 +62,6 @@ class Player : public Entity {
 
     int m_ThrustChannel;
     std::unique_ptr<Timer> pTimer;
-    std::unique_ptr<PlayerShot> pShots[40];
     std::unique_ptr<PlayerShip> pShip;
     Color ShipColor;
 };
@@ -1,13 +0,0 @@
-#pragma once
-
-#include "Shot.h"
-
-namespace omegarace {
-
-class PlayerShot : public Shot {
-  public:
-    PlayerShot();
-    ~PlayerShot();
-};
-
-} // namespace omegarace
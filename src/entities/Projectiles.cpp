@@ -0,0 +1,247 @@
+#include "Projectiles.h"
+#include "Jobs.h"
+#include "SimClock.h"
+#include <cmath>
+
+namespace omegarace {
+
+namespace {
+
+struct ShotKind {
+    float speed;
+    float lifetime; // seconds
+    Color color;
+};
+
+const ShotKind SHOT_KINDS[Projectiles::OWNER_COUNT] = {
+    {350.0f, 2.1f, {255, 255, 0, 255}}, // Player: yellow
+    {250.0f, 1.6f, {100, 200, 255, 255}}, // Lead enemy: bright cyan/blue laser core
+    {250.0f, 1.6f, {100, 200, 255, 255}}, // Fighter
+};
+
+const float HALF_SIZE = 1.0f; // Shots test the borders as a 2x2 square
+const float MUZZLE_OFFSET = 15.0f;
+const int SLOTS_PER_JOB = 256; // Only worth forking once a few hundred shots are out
+
+} // namespace
+
+alignas(16) float Projectiles::mX[CAPACITY];
+alignas(16) float Projectiles::mY[CAPACITY];
+alignas(16) float Projectiles::mVelocityX[CAPACITY];
+alignas(16) float Projectiles::mVelocityY[CAPACITY];
+uint64_t Projectiles::mExpiryTick[CAPACITY];
+uint8_t Projectiles::mOwner[CAPACITY];
+uint8_t Projectiles::mActive[CAPACITY];
+uint8_t Projectiles::mRetiring[CAPACITY];
+uint16_t Projectiles::mGeneration[CAPACITY];
+uint16_t Projectiles::mFree[CAPACITY];
+int Projectiles::mFreeCount = 0;
+int Projectiles::mSlotCount = 0;
+int Projectiles::mOwnerCount[OWNER_COUNT];
+uint8_t Projectiles::mInsideLineHits[OWNER_COUNT];
+uint8_t Projectiles::mOutsideLineHits[OWNER_COUNT];
+SDL_Rect Projectiles::mInsideBorder;
+
+PoolHandle Projectiles::Fire(Owner owner, const Vector2f& location, float angle) {
+    int slot;
+    if (mFreeCount > 0) {
+        slot = mFree[--mFreeCount];
+    } else if (mSlotCount < CAPACITY) {
+        slot = mSlotCount++;
+    } else {
+        return PoolHandle();
+    }
+
+    const ShotKind& kind = SHOT_KINDS[owner];
+    float sinRot = sin(angle);
+    float cosRot = cos(angle);
+
+    mX[slot] = location.x + cosRot * MUZZLE_OFFSET;
+    mY[slot] = location.y + sinRot * MUZZLE_OFFSET;
+    mVelocityX[slot] = cosRot * kind.speed;
+    mVelocityY[slot] = sinRot * kind.speed;
+    mExpiryTick[slot] = SimClock::Ticks() + (uint64_t)std::ceil(kind.lifetime / SimClock::Step());
+    mOwner[slot] = owner;
+    mActive[slot] = 1;
+    mOwnerCount[owner]++;
+    return {(uint16_t)slot, mGeneration[slot]};
+}
+
+void Projectiles::Update(double frame) {
+    for (int owner = 0; owner < OWNER_COUNT; owner++) {
+        mInsideLineHits[owner] = 0;
+        mOutsideLineHits[owner] = 0;
+    }
+
+    const float step = (float)frame;
+    const int count = mSlotCount;
+    const uint64_t now = SimClock::Ticks();
+    const float width = (float)Window::GetWindowSize().x;
+    const float height = (float)Window::GetWindowSize().y;
+    const float insideLeft = (float)mInsideBorder.x;
+    const float insideRight = (float)(mInsideBorder.x + mInsideBorder.w);
+    const float insideTop = (float)mInsideBorder.y;
+    const float insideBottom = (float)(mInsideBorder.y + mInsideBorder.h);
+
+    // Slots are independent until they retire, so slices of them move and flag on the job workers
+    Jobs::ParallelFor(count, SLOTS_PER_JOB, [=](int begin, int end) {
+        // Move every slot in one straight pass; free slots have no velocity
+        for (int slot = begin; slot < end; slot++) {
+            mX[slot] += mVelocityX[slot] * step;
+            mY[slot] += mVelocityY[slot] * step;
+        }
+
+        // Flag the shots leaving play, also without branching: out of time, off the arena or into the
+        // status display
+        for (int slot = begin; slot < end; slot++) {
+            const float x = mX[slot];
+            const float y = mY[slot];
+            const bool expired = mExpiryTick[slot] <= now;
+            const bool offArena = (x < HALF_SIZE) | (x + HALF_SIZE > width) | (y < HALF_SIZE) | (y + HALF_SIZE > height);
+            const bool inBorder = (x + HALF_SIZE >= insideLeft) & (x - HALF_SIZE <= insideRight) &
+                                  (y + HALF_SIZE >= insideTop) & (y - HALF_SIZE <= insideBottom);
+            mRetiring[slot] = mActive[slot] & (uint8_t)(expired | offArena | inBorder);
+        }
+    });
+
+    // Retiring touches the free list and border hits, so it stays serial and in slot order
+    for (int slot = 0; slot < count; slot++) {
+        if (mRetiring[slot]) {
+            recordBorderHit(slot);
+            retireSlot(slot);
+        }
+    }
+}
+
+void Projectiles::Draw() {
+    for (int slot = 0; slot < mSlotCount; slot++) {
+        if (!mActive[slot]) {
+            continue;
+        }
+
+        // Laser bolt with a motion blur trail back along its velocity
+        Line trailLine;
+        trailLine.start = Vector2i((int)(mX[slot] - mVelocityX[slot] * 0.1f), (int)(mY[slot] - mVelocityY[slot] * 0.1f));
+        trailLine.end = Vector2i((int)mX[slot], (int)mY[slot]);
+
+        Color laserCore = SHOT_KINDS[mOwner[slot]].color;
+        Color trailColor = laserCore;
+        trailColor.alpha = 128;
+        Window::DrawVolumetricLineWithBloom(&trailLine, trailColor, 2.0f, 0.6f);
+
+        // Bright core with a small cross pattern
+        Vector2i coreLocation = trailLine.end;
+        Window::DrawPoint(&coreLocation, laserCore);
+        Vector2i crossPoint;
+        crossPoint = coreLocation + Vector2i(1, 0);
+        Window::DrawPoint(&crossPoint, laserCore);
+        crossPoint = coreLocation + Vector2i(-1, 0);
+        Window::DrawPoint(&crossPoint, laserCore);
+        crossPoint = coreLocation + Vector2i(0, 1);
+        Window::DrawPoint(&crossPoint, laserCore);
+        crossPoint = coreLocation + Vector2i(0, -1);
+        Window::DrawPoint(&crossPoint, laserCore);
+    }
+}
+
+void Projectiles::Clear() {
+    for (int slot = 0; slot < mSlotCount; slot++) {
+        if (mActive[slot]) {
+            retireSlot(slot);
+        }
+    }
+}
+
+void Projectiles::Clear(Owner owner) {
+    for (int slot = 0; slot < mSlotCount; slot++) {
+        if (mActive[slot] && mOwner[slot] == owner) {
+            retireSlot(slot);
+        }
+    }
+}
+
+void Projectiles::SetInsideBorder(const SDL_Rect& border) {
+    mInsideBorder = border;
+}
+
+bool Projectiles::Active(PoolHandle shot) {
+    return shot.valid() && shot.index < mSlotCount && mActive[shot.index] &&
+           mGeneration[shot.index] == shot.generation;
+}
+
+void Projectiles::Retire(PoolHandle shot) {
+    if (Active(shot)) {
+        retireSlot(shot.index);
+    }
+}
+
+Vector2f Projectiles::Location(PoolHandle shot) {
+    return Vector2f(mX[shot.index], mY[shot.index]);
+}
+
+int Projectiles::Count(Owner owner) {
+    return mOwnerCount[owner];
+}
+
+int Projectiles::SlotCount() {
+    return mSlotCount;
+}
+
+PoolHandle Projectiles::HandleAt(int slot) {
+    return mActive[slot] ? PoolHandle{(uint16_t)slot, mGeneration[slot]} : PoolHandle();
+}
+
+Projectiles::Owner Projectiles::OwnerAt(int slot) {
+    return (Owner)mOwner[slot];
+}
+
+bool Projectiles::InsideLineHit(Owner owner, int line) {
+    return (mInsideLineHits[owner] >> line) & 1;
+}
+
+bool Projectiles::OutsideLineHit(Owner owner, int line) {
+    return (mOutsideLineHits[owner] >> line) & 1;
+}
+
+// Private methods ----------------------------------------------------------------
+void Projectiles::retireSlot(int slot) {
+    mActive[slot] = 0;
+    mVelocityX[slot] = 0.0f;
+    mVelocityY[slot] = 0.0f;
+    mGeneration[slot]++;
+    mOwnerCount[mOwner[slot]]--;
+    mFree[mFreeCount++] = (uint16_t)slot;
+}
+
+void Projectiles::recordBorderHit(int slot) {
+    const float x = mX[slot];
+    const float y = mY[slot];
+    const float width = (float)Window::GetWindowSize().x;
+    const float height = (float)Window::GetWindowSize().y;
+    uint8_t& outside = mOutsideLineHits[mOwner[slot]];
+    uint8_t& inside = mInsideLineHits[mOwner[slot]];
+
+    // Outside lines: 0-3 top and bottom halves, 4-7 left and right halves
+    if (x < HALF_SIZE || x + HALF_SIZE > width) {
+        int line = (x > width / 2) ? 6 : 4;
+        outside |= 1 << (line + (y > height / 2 ? 1 : 0));
+    }
+    if (y < HALF_SIZE || y + HALF_SIZE > height) {
+        int line = (y > height / 2) ? 2 : 0;
+        outside |= 1 << (line + (x > width / 2 ? 1 : 0));
+    }
+
+    // Inside lines: 0 top, 1 right, 2 bottom, 3 left
+    const SDL_Rect& border = mInsideBorder;
+    if (x + HALF_SIZE >= border.x && x - HALF_SIZE <= border.x + border.w && y + HALF_SIZE >= border.y &&
+        y - HALF_SIZE <= border.y + border.h) {
+        if (x >= border.x + 5 && x <= border.x + border.w - 5) {
+            inside |= 1 << (y > height / 2 ? 2 : 0);
+        }
+        if (y >= border.y + 5 && y <= border.y + border.h - 5) {
+            inside |= 1 << (x > width / 2 ? 1 : 3);
+        }
+    }
+}
+
+} // namespace omegarace
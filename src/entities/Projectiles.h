@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Pool.h"
+#include "Window.h"
+
+namespace omegarace {
+
+// Every shot in flight, the player's and the enemies', held as parallel arrays. A shot keeps its
+// slot until it expires, leaves the arena or is spent, so owners hold a PoolHandle to it. Update
+// moves every slot in one pass and Draw emits the whole set in one pass.
+class Projectiles {
+  public:
+    enum Owner : uint8_t { OWNER_PLAYER, OWNER_LEAD, OWNER_FIGHTER, OWNER_COUNT };
+
+    static constexpr int CAPACITY = 1024;
+    static constexpr float RADIUS = 2.0f;
+
+    // Launches a shot 15 pixels out from location; invalid handle when every slot is in flight
+    static PoolHandle Fire(Owner owner, const Vector2f& location, float angle);
+    static void Update(double frame); // Move shots, retire expired ones and record border hits
+    static void Draw();
+    static void Clear();
+    static void Clear(Owner owner);
+    static void SetInsideBorder(const SDL_Rect& border);
+
+    static bool Active(PoolHandle shot); // false once the shot is gone, even if its slot is reused
+    static void Retire(PoolHandle shot);
+    static Vector2f Location(PoolHandle shot);
+    static int Count(Owner owner);
+
+    // For walking every shot: slots at or past SlotCount are all free, HandleAt is invalid for a
+    // free slot
+    static int SlotCount();
+    static PoolHandle HandleAt(int slot);
+    static Owner OwnerAt(int slot);
+
+    // Border lines the owner's shots struck during the last Update
+    static bool InsideLineHit(Owner owner, int line);
+    static bool OutsideLineHit(Owner owner, int line);
+
+  private:
+    static void retireSlot(int slot);
+    static void recordBorderHit(int slot);
+
+    alignas(16) static float mX[CAPACITY];
+    alignas(16) static float mY[CAPACITY];
+    alignas(16) static float mVelocityX[CAPACITY]; // zero in free slots, so moving them is harmless
+    alignas(16) static float mVelocityY[CAPACITY];
+    static uint64_t mExpiryTick[CAPACITY];
+    static uint8_t mOwner[CAPACITY];
+    static uint8_t mActive[CAPACITY];
+    static uint8_t mRetiring[CAPACITY];
+    static uint16_t mGeneration[CAPACITY];
+
+    static uint16_t mFree[CAPACITY];
+    static int mFreeCount;
+    static int mSlotCount;
+    static int mOwnerCount[OWNER_COUNT];
+    static uint8_t mInsideLineHits[OWNER_COUNT];
+    static uint8_t mOutsideLineHits[OWNER_COUNT];
+    static SDL_Rect mInsideBorder;
+};
+
+} // namespace omegarace
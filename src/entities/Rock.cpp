@@ -1,8 +1,10 @@
 #include "Rock.h"
+#include "ParticleSystem.h"
+#include "Random.h"
 
 namespace omegarace {
 
-Rock::Rock(std::mt19937& random) : Entity() {
+Rock::Rock() : Entity() {
     // Note: Using FMOD audio system instead of Mix_Chunk
 
     // Rock Color.
@@ -19,10 +21,10 @@ Rock::Rock(std::mt19937& random) : Entity() {
     m_RockVarienceHigh = 8;
     m_Radius = 20.0f;
 
-    initialize(random);
+    initialize();
 }
 
-void Rock::initialize(std::mt19937& random) {
+void Rock::initialize() {
     m_Active = false;
     m_Distroyed = false;
     m_MaxVelocity = 50; // Set a reasonable velocity for rocks
@@ -34,22 +36,7 @@ void Rock::initialize(std::mt19937& random) {
 
     destroyed = false;
     active = false;
-    m_DustActive = false;
-    m_DustTimer = 0.0f;
-    m_DustDuration = 1.5f;
-
-    // Initialize dust particles
-    for (int i = 0; i < 12; i++) {
-        m_DustParticles[i].active = false;
-    }
-}
-
-void Rock::pauseTimer() {
-    pExplosion->pauseTimer();
-}
-
-void Rock::unpauseTimer() {
-    pExplosion->unpauseTimer();
+    m_DustEndTime = 0.0f;
 }
 
 Rock::~Rock() {
@@ -58,41 +45,41 @@ Rock::~Rock() {
 
 // Private methods ----------------------------------------------------------------
 void Rock::buildRock() {
-    m_RockPoints[0].x = m_RockLow + Window::Random(0, m_RockVarienceLow);
-    m_RockPoints[0].y = -m_RockMed - Window::Random(0, m_RockVarienceMed);
+    m_RockPoints[0].x = m_RockLow + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceLow);
+    m_RockPoints[0].y = -m_RockMed - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
 
-    m_RockPoints[1].x = m_RockMed + Window::Random(0, m_RockVarienceMed);
-    m_RockPoints[1].y = -m_RockHigh - Window::Random(0, m_RockVarienceHigh);
+    m_RockPoints[1].x = m_RockMed + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
+    m_RockPoints[1].y = -m_RockHigh - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
 
-    m_RockPoints[2].x = m_RockHigh + Window::Random(0, m_RockVarienceHigh);
-    m_RockPoints[2].y = -m_RockMed - Window::Random(0, m_RockVarienceMed);
+    m_RockPoints[2].x = m_RockHigh + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
+    m_RockPoints[2].y = -m_RockMed - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
 
-    m_RockPoints[3].x = m_RockMed + Window::Random(0, m_RockVarienceMed);
-    m_RockPoints[3].y = m_RockLow + Window::Random(0, m_RockVarienceLow);
+    m_RockPoints[3].x = m_RockMed + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
+    m_RockPoints[3].y = m_RockLow + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceLow);
 
-    m_RockPoints[4].x = m_RockHigh + Window::Random(0, m_RockVarienceHigh);
-    m_RockPoints[4].y = m_RockMed + Window::Random(0, m_RockVarienceMed);
+    m_RockPoints[4].x = m_RockHigh + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
+    m_RockPoints[4].y = m_RockMed + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
 
-    m_RockPoints[5].x = m_RockMed + Window::Random(0, m_RockVarienceMed);
-    m_RockPoints[5].y = m_RockHigh + Window::Random(0, m_RockVarienceHigh);
+    m_RockPoints[5].x = m_RockMed + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
+    m_RockPoints[5].y = m_RockHigh + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
 
-    m_RockPoints[6].x = m_RockLow + Window::Random(0, m_RockVarienceLow);
-    m_RockPoints[6].y = m_RockMed + Window::Random(0, m_RockVarienceMed);
+    m_RockPoints[6].x = m_RockLow + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceLow);
+    m_RockPoints[6].y = m_RockMed + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
 
-    m_RockPoints[7].x = -m_RockMed - Window::Random(0, m_RockVarienceMed);
-    m_RockPoints[7].y = m_RockHigh + Window::Random(0, m_RockVarienceHigh);
+    m_RockPoints[7].x = -m_RockMed - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
+    m_RockPoints[7].y = m_RockHigh + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
 
-    m_RockPoints[8].x = -m_RockHigh - Window::Random(0, m_RockVarienceHigh);
-    m_RockPoints[8].y = m_RockMed + Window::Random(0, m_RockVarienceHigh);
+    m_RockPoints[8].x = -m_RockHigh - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
+    m_RockPoints[8].y = m_RockMed + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
 
-    m_RockPoints[9].x = -m_RockMed - Window::Random(0, m_RockVarienceMed);
-    m_RockPoints[9].y = m_RockLow + Window::Random(0, m_RockVarienceLow);
+    m_RockPoints[9].x = -m_RockMed - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
+    m_RockPoints[9].y = m_RockLow + Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceLow);
 
-    m_RockPoints[10].x = -m_RockHigh - Window::Random(0, m_RockVarienceHigh);
-    m_RockPoints[10].y = -m_RockMed - Window::Random(0, m_RockVarienceMed);
+    m_RockPoints[10].x = -m_RockHigh - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
+    m_RockPoints[10].y = -m_RockMed - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
 
-    m_RockPoints[11].x = -m_RockMed - Window::Random(0, m_RockVarienceMed);
-    m_RockPoints[11].y = -m_RockHigh - Window::Random(0, m_RockVarienceHigh);
+    m_RockPoints[11].x = -m_RockMed - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceMed);
+    m_RockPoints[11].y = -m_RockHigh - Random::Int(Random::STREAM_ROCKS, 0, m_RockVarienceHigh);
 }
 
 void Rock::activate(Vector2f pos, Vector2f vel) {
@@ -104,6 +91,7 @@ void Rock::activate(Vector2f pos, Vector2f vel) {
     m_Active = true;
     destroyed = false;
     m_Distroyed = false;
+    m_DustEndTime = 0.0f;
     buildRock();
 }
 
@@ -114,9 +102,6 @@ void Rock::update(double frame) {
         updateFrame(frame);
     }
 
-    // Always update dust explosion if active (even if rock is destroyed)
-    updateDustExplosion(frame);
-
     if (m_Active && !m_Distroyed) {
         position.x += velocity.x * (float)frame;
         position.y += velocity.y * (float)frame;
@@ -145,11 +130,6 @@ void Rock::draw() {
         rockLine.end = Vector2i((int)(position.x + m_RockPoints[0].x), (int)(position.y + m_RockPoints[0].y));
         Window::DrawVolumetricLine(&rockLine, m_Color);
     }
-
-    // Always draw dust explosion if active (regardless of rock state)
-    if (m_DustActive) {
-        drawDustExplosion();
-    }
 }
 
 void Rock::setDestroyed(bool d) {
@@ -158,128 +138,23 @@ void Rock::setDestroyed(bool d) {
 }
 
 void Rock::triggerDustExplosion() {
-    if (m_DustActive)
+    if (m_DustEndTime > ParticleSystem::Time())
         return; // Already exploding
 
-    m_DustActive = true;
-    m_DustTimer = 0.0f;
-    m_DustDuration = 1.5f; // Shorter than UFO explosions
-
-    // Create dust cloud with 12 particles
-    for (int i = 0; i < 12; i++) {
-        RockDustParticle& particle = m_DustParticles[i];
-        particle.active = true;
-        particle.position = position;
-
-        // Create scattered pattern with lower velocities for dust effect
-        float angle = (i / 12.0f) * 6.28318f + ((rand() % 100) * 0.02f); // 2*PI with random offset
-        float speed = 20.0f + (rand() % 40);                             // 20-60 pixels per second (slower than UFO)
-
-        particle.velocity.x = cos(angle) * speed;
-        particle.velocity.y = sin(angle) * speed;
-
-        particle.maxLife = 1.0f + ((rand() % 100) * 0.01f); // 1-2 seconds
-        particle.life = particle.maxLife;
-        particle.size = 1.0f + ((rand() % 100) * 0.01f); // 1-2 pixel size (smaller than UFO)
-
-        // Start with gray/white dust colors
-        particle.color.red = 180 + (rand() % 75);   // 180-255
-        particle.color.green = 180 + (rand() % 75); // 180-255
-        particle.color.blue = 180 + (rand() % 75);  // 180-255
-        particle.color.alpha = 255;
-    }
-}
-
-void Rock::updateDustExplosion(double frame) {
-    if (!m_DustActive)
-        return;
-
-    m_DustTimer += frame;
-    if (m_DustTimer > m_DustDuration) {
-        active = false;
-    }
-
-    bool anyParticleActive = false;
-    for (int i = 0; i < 12; i++) {
-        RockDustParticle& particle = m_DustParticles[i];
-        if (!particle.active)
-            continue;
-
-        // Update particle position with slight gravity effect
-        particle.position.x += particle.velocity.x * frame;
-        particle.position.y += particle.velocity.y * frame;
-        particle.velocity.y += 30.0f * frame; // Slight downward drift for dust settling
-
-        // Update particle life
-        particle.life -= frame;
-        if (particle.life <= 0) {
-            particle.active = false;
-            continue;
-        }
-
-        anyParticleActive = true;
-
-        // Calculate life ratio for fading
-        float lifeRatio = particle.life / particle.maxLife;
-
-        // Simple dust color transition: Stay grayish but fade to darker
-        if (lifeRatio > 0.5f) {
-            // Stay bright dust color
-            particle.color.red = 180 + (int)(75 * lifeRatio);
-            particle.color.green = 180 + (int)(75 * lifeRatio);
-            particle.color.blue = 180 + (int)(75 * lifeRatio);
-        } else {
-            // Fade to darker gray
-            float fadeRatio = lifeRatio / 0.5f;
-            particle.color.red = (int)(180 * fadeRatio);
-            particle.color.green = (int)(180 * fadeRatio);
-            particle.color.blue = (int)(180 * fadeRatio);
-        }
-
-        // Alpha fade based on life
-        particle.color.alpha = (int)(255 * lifeRatio);
-    }
-
-    // Deactivate explosion when no particles are active
-    if (!anyParticleActive) {
-        m_DustActive = false;
-    }
-}
-
-void Rock::drawDustExplosion() {
-    if (!m_DustActive)
-        return;
-
-    for (int i = 0; i < 12; i++) {
-        RockDustParticle& particle = m_DustParticles[i];
-        if (!particle.active)
-            continue;
-
-        // Draw particle as a small dot/line
-        Vector2i particlePos((int)particle.position.x, (int)particle.position.y);
-
-        // Draw core dust particle as a small line
-        Line dustLine;
-        dustLine.start = particlePos;
-        dustLine.end = Vector2i(particlePos.x + (int)particle.size, particlePos.y);
-        Window::DrawVolumetricLine(&dustLine, particle.color);
-
-        // Add a small cross pattern for more dust-like appearance
-        if (particle.color.alpha > 50) {
-            Color fadedColor = particle.color;
-            fadedColor.alpha = particle.color.alpha / 2;
-
-            // Vertical line
-            dustLine.start = Vector2i(particlePos.x, particlePos.y - 1);
-            dustLine.end = Vector2i(particlePos.x, particlePos.y + 1);
-            Window::DrawVolumetricLine(&dustLine, fadedColor);
-
-            // Horizontal line
-            dustLine.start = Vector2i(particlePos.x - 1, particlePos.y);
-            dustLine.end = Vector2i(particlePos.x + 1, particlePos.y);
-            Window::DrawVolumetricLine(&dustLine, fadedColor);
-        }
-    }
+    // Dust cloud: 12 slow gray specks that settle under slight gravity (shorter than UFO explosions)
+    ParticleSystem::Burst dust;
+    dust.origin = position;
+    dust.palette = ParticleSystem::PALETTE_DUST;
+    dust.count = 12;
+    dust.gravity = 30.0f;
+    dust.angleJitter = 2.0f;
+    dust.minSpeed = 20.0f;
+    dust.maxSpeed = 60.0f;
+    dust.minLife = 1.0f;
+    dust.maxLife = 2.0f;
+    dust.minSize = 1.0f;
+    dust.maxSize = 2.0f;
+    m_DustEndTime = ParticleSystem::Emit(dust);
 }
 
 void Rock::checkForEdge() {
@@ -374,16 +249,4 @@ void Rock::checkForEdge() {
     }
 }
 
-void Rock::forceResetDustExplosion() {
-    // Immediately reset dust explosion state
-    m_DustActive = false;
-    m_DustTimer = 0.0f;
-
-    // Deactivate all dust particles
-    for (int i = 0; i < 12; i++) {
-        m_DustParticles[i].active = false;
-        m_DustParticles[i].life = 0.0f;
-    }
-}
-
 } // namespace omegarace
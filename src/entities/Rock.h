@@ -16,23 +16,9 @@ class Rock : public Entity {
 
     void buildRock();
 
-    // SimpleRock dust explosion system
-    struct RockDustParticle {
-        Vector2f position;
-        Vector2f velocity;
-        Color color;
-        float life;
-        float maxLife;
-        float size;
-        bool active;
-    };
-    RockDustParticle m_DustParticles[12]; // Fewer particles for dust effect
-    bool m_DustActive;
-    float m_DustTimer;
-    float m_DustDuration;
-
   protected:
     bool m_Distroyed;
+    float m_DustEndTime; // Particle time this rock's dust burst is gone at
     int m_MaxVelocity;
     int m_RockLow;
     int m_RockMed;
@@ -43,21 +29,16 @@ class Rock : public Entity {
     int m_RockVarienceLow;
 
   public:
-    Rock(std::mt19937& random);
+    Rock();
     ~Rock();
 
-    void initialize(std::mt19937& random);
-    void pauseTimer();
-    void unpauseTimer();
+    void initialize();
 
     // SimpleRock compatibility methods (actively used by GameController)
     void activate(Vector2f pos, Vector2f vel);
     void update(double frame);
     void draw();
     void triggerDustExplosion();
-    void updateDustExplosion(double frame);
-    void drawDustExplosion();
-    void forceResetDustExplosion(); // NEW: Force immediate dust explosion reset
     void checkForEdge();
     bool isDestroyed() const {
         return m_Distroyed;
@@ -69,9 +50,6 @@ class Rock : public Entity {
     float getRadius() const {
         return m_Radius;
     }
-    bool isDustActive() const {
-        return m_DustActive;
-    }
     Vector2f position; // Public access for compatibility
     Vector2f velocity; // Public access for compatibility
     bool destroyed;    // Public access for compatibility
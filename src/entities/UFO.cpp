@@ -1,4 +1,6 @@
 #include "UFO.h"
+#include "ParticleSystem.h"
+#include "Random.h"
 #include "Window.h"
 #include <ctime>
 
@@ -6,17 +8,12 @@ namespace omegarace {
 
 UFO::UFO()
     : radius(25.0f), destroyed(false), active(false), width(40.0f), directionTimer(0.0f), directionDuration(3.0f),
-      fromLeft(true), explosionActive(false), explosionTimer(0.0f), explosionDuration(3.0f) {
+      fromLeft(true) {
     color.red = 0;
     color.green = 255;
     color.blue = 255;
     color.alpha = 255;
     buildUFO();
-
-    // Initialize explosion particles
-    for (int i = 0; i < 24; i++) {
-        explosionParticles[i].active = false;
-    }
 }
 
 void UFO::buildUFO() {
@@ -88,22 +85,17 @@ void UFO::activate(omegarace::Vector2f pos, bool startFromLeft) {
 
     // Set initial velocity based on starting side
     if (fromLeft) {
-        velocity.x = 60.0f + (rand() % 40);  // 60-100 pixels per second rightward
-        velocity.y = -20.0f + (rand() % 40); // -20 to +20 vertical movement
+        velocity.x = 60.0f + Random::Int(Random::STREAM_AI, 0, 39);  // 60-100 pixels per second rightward
+        velocity.y = -20.0f + Random::Int(Random::STREAM_AI, 0, 39); // -20 to +20 vertical movement
     } else {
-        velocity.x = -60.0f - (rand() % 40); // -60 to -100 pixels per second leftward
-        velocity.y = -20.0f + (rand() % 40); // -20 to +20 vertical movement
+        velocity.x = -60.0f - Random::Int(Random::STREAM_AI, 0, 39); // -60 to -100 pixels per second leftward
+        velocity.y = -20.0f + Random::Int(Random::STREAM_AI, 0, 39); // -20 to +20 vertical movement
     }
 
     buildUFO();
 }
 
 void UFO::update(double frame) {
-    // Always update explosion if active, even if UFO is not active
-    if (explosionActive) {
-        updateExplosion(frame);
-    }
-
     if (!active || destroyed)
         return;
 
@@ -116,7 +108,7 @@ void UFO::update(double frame) {
     if (directionTimer >= directionDuration) {
         changeDirection();
         directionTimer = 0.0f;
-        directionDuration = 2.0f + ((rand() % 200) * 0.01f); // 2-4 second intervals
+        directionDuration = 2.0f + (Random::Int(Random::STREAM_AI, 0, 199) * 0.01f); // 2-4 second intervals
     }
 
     // Deactivate if UFO moves off screen horizontally
@@ -139,12 +131,12 @@ void UFO::changeDirection() {
     // Random direction change
     float angle;
     if (fromLeft) {
-        angle = 0.1f + ((rand() % 200) * 0.01f); // Slight upward or downward angle
+        angle = 0.1f + (Random::Int(Random::STREAM_AI, 0, 199) * 0.01f); // Slight upward or downward angle
     } else {
-        angle = 3.14f - 0.1f - ((rand() % 200) * 0.01f); // Slight upward or downward angle
+        angle = 3.14f - 0.1f - (Random::Int(Random::STREAM_AI, 0, 199) * 0.01f); // Slight upward or downward angle
     }
 
-    float speed = 60.0f + (rand() % 40); // 60-100 speed
+    float speed = 60.0f + Random::Int(Random::STREAM_AI, 0, 39); // 60-100 speed
     velocity.x = cos(angle) * speed;
     velocity.y = sin(angle) * speed;
 }
@@ -159,166 +151,26 @@ void UFO::draw() {
             Window::DrawLine(&ufoLine, color);
         }
     }
-
-    // Always draw explosion if active (regardless of UFO state)
-    if (explosionActive) {
-        drawExplosion();
-    }
 }
 
 void UFO::triggerExplosion() {
-    if (explosionActive)
-        return; // Already exploding
-
     // Immediately set UFO as destroyed and inactive for instant visual feedback
     destroyed = true;
     active = false;
 
-    explosionActive = true;
-    explosionTimer = 0.0f;
-    explosionDuration = 3.0f; // Longer than enemy explosions
-
-    // Create spectacular UFO explosion with 24 particles
-    for (int i = 0; i < 24; i++) {
-        UFOExplosionParticle& particle = explosionParticles[i];
-        particle.active = true;
-        particle.position = position;
-
-        // Create expanding ring pattern with some randomness
-        float angle = (i / 24.0f) * 6.28318f + ((rand() % 100) * 0.01f); // 2*PI with random offset
-        float speed = 80.0f + (rand() % 120);                            // 80-200 pixels per second
-
-        particle.velocity.x = cos(angle) * speed;
-        particle.velocity.y = sin(angle) * speed;
-
-        particle.maxLife = 2.5f + ((rand() % 100) * 0.01f); // 2.5-3.5 seconds
-        particle.life = particle.maxLife;
-        particle.size = 3.0f + ((rand() % 100) * 0.02f); // 3-5 pixel size
-
-        // Start with bright cyan/white (UFO color theme)
-        particle.color.red = 255;
-        particle.color.green = 255;
-        particle.color.blue = 255;
-        particle.color.alpha = 255;
-    }
-}
-
-void UFO::updateExplosion(double frame) {
-    if (!explosionActive)
-        return;
-
-    explosionTimer += frame;
-
-    bool anyParticleActive = false;
-    for (int i = 0; i < 24; i++) {
-        UFOExplosionParticle& particle = explosionParticles[i];
-        if (!particle.active)
-            continue;
-
-        // Update particle position
-        particle.position.x += particle.velocity.x * frame;
-        particle.position.y += particle.velocity.y * frame;
-
-        // Update particle life
-        particle.life -= frame;
-        if (particle.life <= 0) {
-            particle.active = false;
-            continue;
-        }
-
-        anyParticleActive = true;
-
-        // Calculate life ratio for color transitions
-        float lifeRatio = particle.life / particle.maxLife;
-
-        // UFO-specific color transitions: White -> Cyan -> Blue -> Purple -> Dark
-        if (lifeRatio > 0.8f) {
-            // Bright white flash (20% of life)
-            particle.color.red = 255;
-            particle.color.green = 255;
-            particle.color.blue = 255;
-        } else if (lifeRatio > 0.6f) {
-            // Transition to bright cyan (20% of life)
-            float transition = (lifeRatio - 0.6f) / 0.2f;
-            particle.color.red = (int)(255 * transition);
-            particle.color.green = 255;
-            particle.color.blue = 255;
-        } else if (lifeRatio > 0.4f) {
-            // Cyan to blue transition (20% of life)
-            float transition = (lifeRatio - 0.4f) / 0.2f;
-            particle.color.red = 0;
-            particle.color.green = (int)(255 * transition);
-            particle.color.blue = 255;
-        } else if (lifeRatio > 0.2f) {
-            // Blue to purple transition (20% of life)
-            float transition = (lifeRatio - 0.2f) / 0.2f;
-            particle.color.red = (int)(128 * (1.0f - transition));
-            particle.color.green = 0;
-            particle.color.blue = 255;
-        } else {
-            // Purple fade to dark (20% of life)
-            float transition = lifeRatio / 0.2f;
-            particle.color.red = (int)(128 * transition);
-            particle.color.green = 0;
-            particle.color.blue = (int)(255 * transition);
-        }
-
-        // Alpha fade based on life - use linear fade instead of quadratic for better visibility
-        particle.color.alpha = (int)(255 * lifeRatio); // Linear fade instead of quadratic
-    }
-
-    // Deactivate explosion when no particles are active
-    if (!anyParticleActive) {
-        explosionActive = false;
-    }
-}
-
-void UFO::drawExplosion() {
-    if (!explosionActive)
-        return;
-
-    for (int i = 0; i < 24; i++) {
-        UFOExplosionParticle& particle = explosionParticles[i];
-        if (!particle.active)
-            continue;
-
-        // Draw particle as a small circle with bloom effect
-        Vector2i particlePos((int)particle.position.x, (int)particle.position.y);
-
-        // Draw core particle
-        Line particleLine;
-        particleLine.start = particlePos;
-        particleLine.end = Vector2i(particlePos.x + (int)particle.size, particlePos.y);
-        Window::DrawLine(&particleLine, particle.color);
-
-        // Draw bloom effect with multiple lines at reduced alpha
-        Color bloomColor = particle.color;
-        bloomColor.alpha /= 3; // Reduce alpha for bloom
-
-        // Horizontal bloom
-        Line bloomLineH;
-        bloomLineH.start = Vector2i(particlePos.x - 1, particlePos.y);
-        bloomLineH.end = Vector2i(particlePos.x + (int)particle.size + 1, particlePos.y);
-        Window::DrawLine(&bloomLineH, bloomColor);
-
-        // Vertical bloom
-        Line bloomLineV;
-        bloomLineV.start = Vector2i(particlePos.x, particlePos.y - 1);
-        bloomLineV.end = Vector2i(particlePos.x, particlePos.y + 1);
-        Window::DrawLine(&bloomLineV, bloomColor);
-    }
-}
-
-void UFO::forceResetExplosion() {
-    // Immediately reset explosion state
-    explosionActive = false;
-    explosionTimer = 0.0f;
-
-    // Deactivate all explosion particles
-    for (int i = 0; i < 24; i++) {
-        explosionParticles[i].active = false;
-        explosionParticles[i].life = 0.0f;
-    }
+    // Spectacular expanding ring of 24 particles in the UFO colour theme
+    ParticleSystem::Burst burst;
+    burst.origin = position;
+    burst.palette = ParticleSystem::PALETTE_UFO;
+    burst.count = 24;
+    burst.angleJitter = 1.0f;
+    burst.minSpeed = 80.0f;
+    burst.maxSpeed = 200.0f;
+    burst.minLife = 2.5f;
+    burst.maxLife = 3.5f;
+    burst.minSize = 3.0f;
+    burst.maxSize = 5.0f;
+    ParticleSystem::Emit(burst);
 }
 
 } // namespace omegarace
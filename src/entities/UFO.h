@@ -18,9 +18,6 @@ class UFO : public Common {
 
     // Explosion system
     void triggerExplosion();
-    void updateExplosion(double frame);
-    void drawExplosion();
-    void forceResetExplosion(); // NEW: Force immediate explosion reset
 
     // State getters/setters
     bool isDestroyed() const {
@@ -41,9 +38,6 @@ class UFO : public Common {
     void setActive(bool a) {
         active = a;
     }
-    bool isExplosionActive() const {
-        return explosionActive;
-    }
 
   private:
     void buildUFO();
@@ -60,21 +54,6 @@ class UFO : public Common {
     float directionTimer;
     float directionDuration;
     bool fromLeft;
-
-    // UFO Explosion system
-    struct UFOExplosionParticle {
-        omegarace::Vector2f position;
-        omegarace::Vector2f velocity;
-        omegarace::Color color;
-        float life;
-        float maxLife;
-        float size;
-        bool active;
-    };
-    UFOExplosionParticle explosionParticles[24]; // More particles than enemies
-    bool explosionActive;
-    float explosionTimer;
-    float explosionDuration;
 };
 
 } // namespace omegarace
@@ -6,6 +6,12 @@ namespace omegarace {
 Borders::Borders() {
     pTimer = std::make_unique<Timer>();
 
+    m_StaticLineBuffer = BGFX_INVALID_HANDLE;
+    m_BorderVertexCount = 0;
+    m_DotVertexCount = 0;
+    m_BarrierVertexBuffer = BGFX_INVALID_HANDLE;
+    m_BarrierIndexBuffer = BGFX_INVALID_HANDLE;
+
     // Initialize Geometry Wars grid parameters
     m_GridSpacing = 40; // Distance between grid lines
     m_GridAnimationTime = 0.0f;
@@ -20,6 +26,7 @@ Borders::Borders() {
 }
 
 Borders::~Borders() {
+    destroyStaticGeometry();
 }
 
 void Borders::initialize() {
@@ -96,6 +103,82 @@ void Borders::initialize() {
     outsideDots[5] = outsideFieldLines[3].start;
     outsideDots[6] = outsideFieldLines[5].start;
     outsideDots[7] = outsideFieldLines[6].start;
+
+    buildStaticGeometry();
+}
+
+void Borders::buildStaticGeometry() {
+    destroyStaticGeometry();
+
+    // Central rectangle border lines
+    Line borderLines[4];
+    borderLines[0].start = Vector2i(insideBorder.x, insideBorder.y);
+    borderLines[0].end = Vector2i(insideBorder.x + insideBorder.w, insideBorder.y);
+    borderLines[1].start = borderLines[0].end;
+    borderLines[1].end = Vector2i(insideBorder.x + insideBorder.w, insideBorder.y + insideBorder.h);
+    borderLines[2].start = borderLines[1].end;
+    borderLines[2].end = Vector2i(insideBorder.x, insideBorder.y + insideBorder.h);
+    borderLines[3].start = borderLines[2].end;
+    borderLines[3].end = borderLines[0].start;
+
+    // White border first, then each dot as a 1x1 outline (what DrawPoint used to draw)
+    std::vector<Line> lines;
+    std::vector<Color> colors;
+    Color whiteColor = {255, 255, 255, 255};
+    for (int i = 0; i < 4; i++) {
+        lines.push_back(borderLines[i]);
+        colors.push_back(whiteColor);
+    }
+
+    for (int dot = 0; dot < 16; dot++) {
+        Vector2i p = dot < 8 ? insideDots[dot] : outsideDots[dot - 8];
+        Vector2i corners[4] = {p, Vector2i(p.x + 1, p.y), Vector2i(p.x + 1, p.y + 1), Vector2i(p.x, p.y + 1)};
+        for (int side = 0; side < 4; side++) {
+            lines.push_back({corners[side], corners[(side + 1) % 4]});
+            colors.push_back(lineColor);
+        }
+    }
+
+    m_BorderVertexCount = 4 * 2;
+    m_DotVertexCount = (uint32_t)lines.size() * 2 - m_BorderVertexCount;
+    m_StaticLineBuffer = Window::CreateStaticLineBuffer(lines.data(), colors.data(), (int)lines.size());
+
+    // Electric barrier quads: central border, inside field lines, outside field lines
+    Line barrierLines[BARRIER_COUNT];
+    Color barrierColors[BARRIER_COUNT];
+    Color borderElectricColor = {0, 200, 255, 255}; // Electric blue for central border
+    Color electricColor = {0, 255, 255, 255};       // Electric cyan
+    for (int i = 0; i < 4; i++) {
+        barrierLines[BARRIER_CENTRAL + i] = borderLines[i];
+        barrierColors[BARRIER_CENTRAL + i] = borderElectricColor;
+        barrierLines[BARRIER_INSIDE + i] = insideFieldLines[i];
+        barrierColors[BARRIER_INSIDE + i] = electricColor;
+    }
+
+    for (int i = 0; i < 8; i++) {
+        barrierLines[BARRIER_OUTSIDE + i] = outsideFieldLines[i];
+        barrierColors[BARRIER_OUTSIDE + i] = electricColor;
+    }
+
+    Window::CreateStaticElectricBarrier(barrierLines, barrierColors, BARRIER_COUNT, 12.0f, m_BarrierVertexBuffer,
+                                        m_BarrierIndexBuffer);
+}
+
+void Borders::destroyStaticGeometry() {
+    if (bgfx::isValid(m_StaticLineBuffer)) {
+        bgfx::destroy(m_StaticLineBuffer);
+        m_StaticLineBuffer = BGFX_INVALID_HANDLE;
+    }
+
+    if (bgfx::isValid(m_BarrierVertexBuffer)) {
+        bgfx::destroy(m_BarrierVertexBuffer);
+        m_BarrierVertexBuffer = BGFX_INVALID_HANDLE;
+    }
+
+    if (bgfx::isValid(m_BarrierIndexBuffer)) {
+        bgfx::destroy(m_BarrierIndexBuffer);
+        m_BarrierIndexBuffer = BGFX_INVALID_HANDLE;
+    }
 }
 
 void Borders::update() {
@@ -118,76 +201,37 @@ void Borders::update() {
 }
 
 void Borders::draw() {
-    // Create four lines for the rectangle border
-    Line borderLines[4];
-    
-    // Top line
-    borderLines[0].start = Vector2i(insideBorder.x, insideBorder.y);
-    borderLines[0].end = Vector2i(insideBorder.x + insideBorder.w, insideBorder.y);
-    
-    // Right line  
-    borderLines[1].start = Vector2i(insideBorder.x + insideBorder.w, insideBorder.y);
-    borderLines[1].end = Vector2i(insideBorder.x + insideBorder.w, insideBorder.y + insideBorder.h);
-    
-    // Bottom line
-    borderLines[2].start = Vector2i(insideBorder.x + insideBorder.w, insideBorder.y + insideBorder.h);
-    borderLines[2].end = Vector2i(insideBorder.x, insideBorder.y + insideBorder.h);
-    
-    // Left line
-    borderLines[3].start = Vector2i(insideBorder.x, insideBorder.y + insideBorder.h);
-    borderLines[3].end = Vector2i(insideBorder.x, insideBorder.y);
-    
+    // Geometry is static; a hit only changes which ranges are drawn and the per-line fade uniform
+    double currentTime = pTimer->seconds();
+
     // Draw central border - electric when hit, solid white otherwise
     if (centralBorderElectricOn) {
-        // Electric effect when hit with quadruple thickness
-        double currentTime = pTimer->seconds();
-        double timeRemaining = centralBorderTimer - currentTime;
-        Color borderElectricColor = {0, 200, 255, 255}; // Electric blue for central border
-        
+        float timeRemaining = (float)(centralBorderTimer - currentTime);
         for (int i = 0; i < 4; i++) {
-            Window::DrawElectricBarrierLine(&borderLines[i], borderElectricColor, 
-                                          10.0f, 12.0f, (float)timeRemaining); // Quadrupled thickness from 3.0f to 12.0f
+            Window::DrawStaticElectricBarrierLine(m_BarrierVertexBuffer, m_BarrierIndexBuffer, BARRIER_CENTRAL + i,
+                                                  10.0f, 12.0f, timeRemaining);
         }
+        Window::DrawStaticLines(m_StaticLineBuffer, m_BorderVertexCount, m_DotVertexCount);
     } else {
-        // Normal solid white lines
-        Color whiteColor = {255, 255, 255, 255};
-        for (int i = 0; i < 4; i++) {
-            Window::DrawLine(&borderLines[i], whiteColor);
-        }
+        Window::DrawStaticLines(m_StaticLineBuffer, 0, m_BorderVertexCount + m_DotVertexCount);
     }
 
-    for (int dot = 0; dot < 8; dot++) {
-        Window::DrawPoint(&insideDots[dot], lineColor);
-    }
-
-    // Draw inside field lines with shader-based electric barrier effect
+    // Inside field lines light up with the electric barrier effect when hit
     for (int line = 0; line < 4; line++) {
         if (insideLineOn[line]) {
-            // Calculate time remaining for fade effect
-            double currentTime = pTimer->seconds();
-            double timeRemaining = insideLineTimers[line] - currentTime;
-            
-            // Use new shader-based electric barrier line with even thicker lines when hit
-            Color electricColor = {0, 255, 255, 255}; // Electric cyan
-            Window::DrawElectricBarrierLine(&insideFieldLines[line], electricColor, 
-                                          15.0f, 12.0f, (float)timeRemaining); // Increased thickness from 8.0f to 12.0f
+            float timeRemaining = (float)(insideLineTimers[line] - currentTime);
+            Window::DrawStaticElectricBarrierLine(m_BarrierVertexBuffer, m_BarrierIndexBuffer, BARRIER_INSIDE + line,
+                                                  15.0f, 12.0f, timeRemaining);
         }
     }
 
-    // Draw outside field lines with shader-based electric barrier effect
+    // Outside field lines light up with the electric barrier effect when hit
     for (int line = 0; line < 8; line++) {
         if (outsideLineOn[line]) {
-            // Calculate time remaining for fade effect
-            double currentTime = pTimer->seconds();
-            double timeRemaining = outsideLineTimers[line] - currentTime;
-            
-            // Use new shader-based electric barrier line with even thicker lines when hit
-            Color electricColor = {0, 255, 255, 255}; // Electric cyan
-            Window::DrawElectricBarrierLine(&outsideFieldLines[line], electricColor, 
-                                          15.0f, 12.0f, (float)timeRemaining); // Increased thickness from 8.0f to 12.0f
+            float timeRemaining = (float)(outsideLineTimers[line] - currentTime);
+            Window::DrawStaticElectricBarrierLine(m_BarrierVertexBuffer, m_BarrierIndexBuffer, BARRIER_OUTSIDE + line,
+                                                  15.0f, 12.0f, timeRemaining);
         }
-
-        Window::DrawPoint(&outsideDots[line], lineColor);
     }
 }
 
@@ -32,6 +32,9 @@ class Borders {
     void resetGridBackground();
 
   private:
+    void buildStaticGeometry();
+    void destroyStaticGeometry();
+
     Line outsideLines[4];
     Line insideLines[4];
     Line newOutsideLines[4];
@@ -58,6 +61,15 @@ class Borders {
     float m_DistortionStrength;
     Color m_GridColor;
 
+    // Persistent GPU geometry, rebuilt only by initialize(). The line buffer holds the white border
+    // followed by the dots; the barrier buffers hold one quad per electric line (see BarrierLine).
+    enum BarrierLine { BARRIER_CENTRAL = 0, BARRIER_INSIDE = 4, BARRIER_OUTSIDE = 8, BARRIER_COUNT = 16 };
+    bgfx::VertexBufferHandle m_StaticLineBuffer;
+    uint32_t m_BorderVertexCount;
+    uint32_t m_DotVertexCount;
+    bgfx::VertexBufferHandle m_BarrierVertexBuffer;
+    bgfx::IndexBufferHandle m_BarrierIndexBuffer;
+
     std::unique_ptr<Timer> pTimer;
     SDL_Rect insideBorder;
     Color lineColor;
@@ -1,4 +1,6 @@
 #include "Explosion.h"
+#include "ParticleSystem.h"
+#include "Random.h"
 #include "Window.h"
 
 namespace omegarace {
@@ -36,21 +38,23 @@ void Explosion::activate(const Vector2i& location, int size) {
     float angle = 0;
 
     for (int line = 0; line < 12; line++) {
-        angle += (Window::Random(0, 630)) * 0.01;
+        angle += (Random::Int(Random::STREAM_EFFECTS, 0, 630)) * 0.01;
         pLines[line]->activate(location, angle, size);
     }
-}
 
-void Explosion::pauseTimer() {
-    for (int line = 0; line < 12; line++) {
-        pLines[line]->pauseTimer();
-    }
-}
-
-void Explosion::unpauseTimer() {
-    for (int line = 0; line < 12; line++) {
-        pLines[line]->unpauseTimer();
-    }
+    // Short-lived sparks thrown off while the lines are still white-hot
+    ParticleSystem::Burst sparks;
+    sparks.origin = Vector2f((float)location.x, (float)location.y);
+    sparks.palette = ParticleSystem::PALETTE_SPARK;
+    sparks.count = 24;
+    sparks.angleJitter = 6.28318f;
+    sparks.minSpeed = 20.0f;
+    sparks.maxSpeed = 60.0f;
+    sparks.minLife = 0.25f;
+    sparks.maxLife = 0.45f;
+    sparks.minSize = 3.0f;
+    sparks.maxSize = 8.0f;
+    ParticleSystem::Emit(sparks);
 }
 
 bool Explosion::getActive() {
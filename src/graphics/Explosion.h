@@ -12,8 +12,6 @@ class Explosion {
     void draw();
     void update(double frame);
     void activate(const Vector2i& location, int size);
-    void pauseTimer();
-    void unpauseTimer();
     bool getActive();
 
   private:
@@ -1,4 +1,5 @@
 #include "ExplosionLine.h"
+#include "Random.h"
 #include "Window.h"
 
 namespace omegarace {
@@ -30,11 +31,6 @@ void ExplosionLine::draw() {
         Color dynamicColor = calculateExplosionColor();
 
         Window::DrawVolumetricLineWithBloom(&m_Line, dynamicColor, m_CurrentThickness * 1.5f, 0.8f);
-
-        // Add sparks effect during early explosion phase
-        if (m_ExplosionPhase < 0.4f) {
-            drawExplosionSparks();
-        }
     }
 }
 
@@ -73,7 +69,7 @@ void ExplosionLine::update(double Frame) {
 
 void ExplosionLine::activate(const Vector2i& location, float angle, int size) {
     m_Active = true;
-    m_Location = location + Vector2i(Window::Random(0, size), Window::Random(0, size));
+    m_Location = location + Vector2i(Random::Int(Random::STREAM_EFFECTS, 0, size), Random::Int(Random::STREAM_EFFECTS, 0, size));
     m_Line.start = location;
     m_Line.end = location;
     double frame = 0;
@@ -84,13 +80,13 @@ void ExplosionLine::activate(const Vector2i& location, float angle, int size) {
 
     int maxV = 35; // Increased max velocity for more dramatic effect
     int minV = 20; // Increased min velocity
-    m_Velocity = Vector2f(cosRot * (float)Window::Random(minV, maxV), sinRot * (float)Window::Random(minV, maxV));
-    m_Timer = pTimer->seconds() + (float)Window::Random(m_TimerAmount / 2, m_TimerAmount) * 0.01;
+    m_Velocity = Vector2f(cosRot * (float)Random::Int(Random::STREAM_EFFECTS, minV, maxV), sinRot * (float)Random::Int(Random::STREAM_EFFECTS, minV, maxV));
+    m_Timer = pTimer->seconds() + (float)Random::Int(Random::STREAM_EFFECTS, m_TimerAmount / 2, m_TimerAmount) * 0.01;
 
     // Reset explosion properties
     m_ExplosionPhase = 0.0f;
     m_InitialThickness = 1.0f;
-    m_MaxThickness = (float)Window::Random(4, 8); // Variable max thickness for variety
+    m_MaxThickness = (float)Random::Int(Random::STREAM_EFFECTS, 4, 8); // Variable max thickness for variety
     m_CurrentThickness = m_InitialThickness;
 
     // Start with bright white-hot color
@@ -132,63 +128,4 @@ Color ExplosionLine::calculateExplosionColor() {
     return result;
 }
 
-void ExplosionLine::drawExplosionSparks() {
-    // Create small spark lines perpendicular to the main explosion line
-    Vector2i lineVec = m_Line.end - m_Line.start;
-    float lineLength = sqrt((float)(lineVec.x * lineVec.x + lineVec.y * lineVec.y));
-
-    if (lineLength > 5.0f) { // Only add sparks to lines that are long enough
-        // Create 1-3 sparks along the line
-        int numSparks = Window::Random(1, 3);
-
-        for (int i = 0; i < numSparks; i++) {
-            // Random position along the explosion line
-            float t = Window::Random(20, 80) / 100.0f;
-            Vector2i sparkStart;
-            sparkStart.x = m_Line.start.x + (int)(lineVec.x * t);
-            sparkStart.y = m_Line.start.y + (int)(lineVec.y * t);
-
-            // Create perpendicular spark direction
-            Vector2i perpVec;
-            perpVec.x = -lineVec.y;
-            perpVec.y = lineVec.x;
-
-            // Normalize and scale
-            float perpLength = sqrt((float)(perpVec.x * perpVec.x + perpVec.y * perpVec.y));
-            if (perpLength > 0) {
-                float sparkLength = Window::Random(3, 8) * (1.0f - m_ExplosionPhase); // Shorter as explosion progresses
-                perpVec.x = (int)(perpVec.x / perpLength * sparkLength);
-                perpVec.y = (int)(perpVec.y / perpLength * sparkLength);
-
-                // Random direction
-                if (Window::Random(0, 1)) {
-                    perpVec.x = -perpVec.x;
-                    perpVec.y = -perpVec.y;
-                }
-
-                Line sparkLine;
-                sparkLine.start = sparkStart;
-                sparkLine.end = sparkStart + perpVec;
-
-                // Bright spark color
-                Color sparkColor;
-                sparkColor.red = 255;
-                sparkColor.green = 200;
-                sparkColor.blue = 100;
-                sparkColor.alpha = (int)(180 * (1.0f - m_ExplosionPhase));
-
-                Window::DrawVolumetricLineWithBloom(&sparkLine, sparkColor, 1.0f, 0.8f);
-            }
-        }
-    }
-}
-
-void ExplosionLine::pauseTimer() {
-    pTimer->pause();
-}
-
-void ExplosionLine::unpauseTimer() {
-    pTimer->unpause();
-}
-
 } // namespace omegarace
@@ -14,8 +14,6 @@ class ExplosionLine : public Entity {
     void update(double Frame);
     void activate(const Vector2i& location, float angle, int size);
     // Needs timer pause and unpause.
-    void pauseTimer();
-    void unpauseTimer();
 
   private:
     float m_Timer;
@@ -33,7 +31,6 @@ class ExplosionLine : public Entity {
 
     // Helper methods for enhanced effects
     Color calculateExplosionColor();
-    void drawExplosionSparks();
 };
 
 } // namespace omegarace
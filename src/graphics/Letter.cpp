@@ -486,21 +486,25 @@ void Letter::initializeLetterLine() {
     letters[25].klines[13] = false;
     letters[25].klines[14] = false;
     letters[25].klines[15] = false;
+
+    // Collapse each letter into a segment mask and build the shared glyph mesh once
+    for (int letter = 0; letter < 26; letter++) {
+        m_LetterMasks[letter] = 0;
+        for (int line = 0; line < 16; line++) {
+            if (letters[letter].klines[line])
+                m_LetterMasks[letter] |= 1u << line;
+        }
+    }
+
+    if (!Window::HasGlyphFont(Window::GLYPH_FONT_LETTERS))
+        Window::CreateGlyphFont(Window::GLYPH_FONT_LETTERS, m_LetterLineStart, m_LetterLineEnd, 16);
 }
 
 void Letter::drawLetter(const Vector2i& location, int letter, int size) {
-    Line LetterLine;
     int sizeIn = size * 0.5;
 
     if (letter > -1 && letter < 26) {
-        for (int line = 0; line < 16; line++) {
-            if (letters[letter].klines[line]) {
-                LetterLine.start = m_LetterLineStart[line] * sizeIn + location;
-                LetterLine.end = m_LetterLineEnd[line] * sizeIn + location;
-
-                Window::DrawLine(&LetterLine, m_Color);
-            }
-        }
+        Window::DrawGlyph(Window::GLYPH_FONT_LETTERS, location, sizeIn, m_LetterMasks[letter], m_Color);
     }
 }
 
@@ -22,6 +22,7 @@ class Letter {
     Color m_Color;
     // Letter Lines
     LetterData letters[26];
+    uint32_t m_LetterMasks[26]; // Lit segments per letter for the glyph cache
     Vector2i m_LetterLineStart[16];
     Vector2i m_LetterLineEnd[16];
 };
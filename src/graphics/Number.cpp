@@ -120,6 +120,18 @@ void Number::initializeNumberLine() {
     numbers[9].lines[4] = false;
     numbers[9].lines[5] = true;
     numbers[9].lines[6] = true;
+
+    // Collapse each digit into a segment mask and build the shared glyph mesh once
+    for (int digit = 0; digit < 10; digit++) {
+        m_NumberMasks[digit] = 0;
+        for (int line = 0; line < 7; line++) {
+            if (numbers[digit].lines[line])
+                m_NumberMasks[digit] |= 1u << line;
+        }
+    }
+
+    if (!Window::HasGlyphFont(Window::GLYPH_FONT_DIGITS))
+        Window::CreateGlyphFont(Window::GLYPH_FONT_DIGITS, m_NumberLineStart, m_NumberLineEnd, 7);
 }
 
 void Number::processNumber(int number, const Vector2i& locationStart, int size) {
@@ -142,18 +154,8 @@ void Number::processNumber(int number, const Vector2i& locationStart, int size)
 }
 
 void Number::drawDigit(const Vector2i& location, int digit, int size) {
-    Line NumberLine;
-    int sizeIn = size;
-
     if (digit > -1 && digit < 10) {
-        for (int line = 0; line < 7; line++) {
-            if (numbers[digit].lines[line]) {
-                NumberLine.start = m_NumberLineStart[line] * sizeIn + location;
-                NumberLine.end = m_NumberLineEnd[line] * sizeIn + location;
-
-                Window::DrawLine(&NumberLine, m_Color);
-            }
-        }
+        Window::DrawGlyph(Window::GLYPH_FONT_DIGITS, location, size, m_NumberMasks[digit], m_Color);
     }
 }
 
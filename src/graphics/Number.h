@@ -21,6 +21,7 @@ class Number {
     Color m_Color;
     // Number lines
     NumberData numbers[10];
+    uint32_t m_NumberMasks[10]; // Lit segments per digit for the glyph cache
     Vector2i m_NumberLineStart[7];
     Vector2i m_NumberLineEnd[7];
 };
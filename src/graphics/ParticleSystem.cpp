@@ -0,0 +1,67 @@
+#include "ParticleSystem.h"
+#include "Random.h"
+
+namespace omegarace {
+
+std::vector<Window::ParticleBurstInstance> ParticleSystem::mBursts;
+std::vector<float> ParticleSystem::mBurstEndTimes;
+float ParticleSystem::mTime = 0.0f;
+
+float ParticleSystem::Emit(const Burst& burst) {
+    Window::ParticleBurstInstance instance;
+    instance.originX = burst.origin.x;
+    instance.originY = burst.origin.y;
+    instance.startTime = mTime;
+    instance.seed = (float)Random::Int(Random::STREAM_EFFECTS, 0, 65535);
+    instance.count = (float)std::min(burst.count, Window::MAX_BURST_PARTICLES);
+    instance.palette = (float)burst.palette;
+    instance.gravity = burst.gravity;
+    instance.angleJitter = burst.angleJitter;
+    instance.minSpeed = burst.minSpeed;
+    instance.speedRange = burst.maxSpeed - burst.minSpeed;
+    instance.minLife = burst.minLife;
+    instance.lifeRange = burst.maxLife - burst.minLife;
+    instance.minSize = burst.minSize;
+    instance.sizeRange = burst.maxSize - burst.minSize;
+    instance.pad0 = 0.0f;
+    instance.pad1 = 0.0f;
+
+    mBursts.push_back(instance);
+    mBurstEndTimes.push_back(mTime + burst.maxLife);
+    return mBurstEndTimes.back();
+}
+
+void ParticleSystem::Update(double frame) {
+    mTime += (float)frame;
+
+    // Swap-remove bursts whose longest-lived particle has expired; draw order does not matter
+    for (size_t i = 0; i < mBursts.size();) {
+        if (mBurstEndTimes[i] <= mTime) {
+            mBursts[i] = mBursts.back();
+            mBurstEndTimes[i] = mBurstEndTimes.back();
+            mBursts.pop_back();
+            mBurstEndTimes.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+void ParticleSystem::Draw() {
+    Window::DrawParticleBursts(mBursts.data(), (int)mBursts.size(), mTime);
+}
+
+void ParticleSystem::Clear() {
+    mBursts.clear();
+    mBurstEndTimes.clear();
+}
+
+int ParticleSystem::ActiveBurstCount() {
+    return (int)mBursts.size();
+}
+
+float ParticleSystem::Time() {
+    return mTime;
+}
+
+} // namespace omegarace
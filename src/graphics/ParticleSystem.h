@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Window.h"
+
+namespace omegarace {
+
+// Shared stateless particle bursts. Emitters record a single spawn event and forget about it; the
+// particles themselves are never stored or integrated on the CPU, the vertex shader evaluates them
+// from the spawn record and the particle clock.
+class ParticleSystem {
+  public:
+    enum Palette { PALETTE_DUST = 0, PALETTE_UFO = 1, PALETTE_SPARK = 2 };
+
+    struct Burst {
+        Vector2f origin;
+        Palette palette = PALETTE_SPARK;
+        int count = 12;
+        float gravity = 0.0f;         // Downward acceleration in pixels per second squared
+        float angleJitter = 0.0f;     // Random offset added to the evenly spread emission angles
+        float minSpeed = 20.0f;
+        float maxSpeed = 60.0f;
+        float minLife = 1.0f;
+        float maxLife = 2.0f;
+        float minSize = 1.0f;
+        float maxSize = 2.0f;
+    };
+
+    static float Emit(const Burst& burst); // Returns the particle time the burst's last particle dies at
+    static void Update(double frame); // Advance the particle clock and retire finished bursts
+    static void Draw();
+    static void Clear();
+
+    static int ActiveBurstCount();
+    static float Time();
+
+  private:
+    static std::vector<Window::ParticleBurstInstance> mBursts;
+    static std::vector<float> mBurstEndTimes;
+    static float mTime;
+};
+
+} // namespace omegarace
@@ -6,6 +6,8 @@ namespace omegarace {
 PauseMenu::PauseMenu() {
     m_IsVisible = false;
     m_SelectedOption = RESUME;
+    m_PanelLayer = Window::CreateRetainedLayer("PauseMenu");
+    m_Dirty = true;
     
     // Initialize menu text
     m_TitleText = "GAME PAUSED";
@@ -61,15 +63,30 @@ void PauseMenu::initialize() {
     // Initialize letter renderer
     pLetter->initializeLetterLine();
     pLetter->setColor(m_NormalColor);
+    m_Dirty = true;
 }
 
 void PauseMenu::draw() {
     if (!m_IsVisible) {
         return;
     }
-        
-    drawBackground();
-    drawMenuOptions();
+
+    if (m_PanelLayer < 0) {
+        drawBackground();
+        drawMenuOptions();
+        return;
+    }
+
+    // Re-render the cached panel only when the selection or layout has changed
+    if (m_Dirty) {
+        Window::BeginRetainedLayer(m_PanelLayer);
+        drawBackground();
+        drawMenuOptions();
+        Window::EndRetainedLayer();
+        m_Dirty = false;
+    }
+
+    Window::DrawRetainedLayer(m_PanelLayer);
 }
 
 void PauseMenu::update() {
@@ -87,6 +104,7 @@ void PauseMenu::handleUp() {
     } else {
         m_SelectedOption = static_cast<MENU_OPTION>(m_SelectedOption - 1);
     }
+    m_Dirty = true;
 }
 
 void PauseMenu::handleDown() {
@@ -100,6 +118,7 @@ void PauseMenu::handleDown() {
     } else {
         m_SelectedOption = static_cast<MENU_OPTION>(m_SelectedOption + 1);
     }
+    m_Dirty = true;
 }
 
 void PauseMenu::handleSelect() {
@@ -130,7 +149,10 @@ void PauseMenu::toggle() {
 }
 
 void PauseMenu::resetSelection() {
-    m_SelectedOption = RESUME;
+    if (m_SelectedOption != RESUME) {
+        m_SelectedOption = RESUME;
+        m_Dirty = true;
+    }
 }
 
 void PauseMenu::drawBackground() {
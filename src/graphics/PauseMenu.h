@@ -44,6 +44,8 @@ private:
     void drawMenuOptions();
     
     bool m_IsVisible;
+    int m_PanelLayer; // Retained layer holding the cached panel, -1 when drawn directly
+    bool m_Dirty;     // Panel contents changed since the layer was last rendered
     MENU_OPTION m_SelectedOption;
     
     // Menu text
@@ -1,4 +1,5 @@
 #include "PlayerExplosionLine.h"
+#include "Random.h"
 
 namespace omegarace {
 
@@ -32,22 +33,22 @@ void PlayerExplosionLine::initialize(const Line& expLine, const Vector2i& locati
 
     // Much more violent explosion forces for catastrophic player death
     int maxForce = 400; // Doubled the force
-    m_Velocity = Vector2f((Window::Random(-maxForce, maxForce) * 0.1f) - (Window::Random(-maxForce, maxForce) * 0.1f),
-                          (Window::Random(-maxForce, maxForce) * 0.1f) - (Window::Random(-maxForce, maxForce) * 0.1f));
+    m_Velocity = Vector2f((Random::Int(Random::STREAM_EFFECTS, -maxForce, maxForce) * 0.1f) - (Random::Int(Random::STREAM_EFFECTS, -maxForce, maxForce) * 0.1f),
+                          (Random::Int(Random::STREAM_EFFECTS, -maxForce, maxForce) * 0.1f) - (Random::Int(Random::STREAM_EFFECTS, -maxForce, maxForce) * 0.1f));
 
     // Initialize catastrophic properties
-    m_MaxLifetime = Window::Random(180, 300) * 0.01f; // 1.8-3.0 seconds duration
+    m_MaxLifetime = Random::Int(Random::STREAM_EFFECTS, 180, 300) * 0.01f; // 1.8-3.0 seconds duration
     m_CurrentLifetime = 0.0f;
     m_InitialThickness = 1.0f;
-    m_MaxThickness = (float)Window::Random(6, 12); // Much thicker fragments
+    m_MaxThickness = (float)Random::Int(Random::STREAM_EFFECTS, 6, 12); // Much thicker fragments
     m_CurrentThickness = m_InitialThickness;
 
     // Add violent spinning to fragments
-    m_RotationSpeed = (Window::Random(-300, 300) * 0.01f); // -3 to +3 radians per second
+    m_RotationSpeed = (Random::Int(Random::STREAM_EFFECTS, -300, 300) * 0.01f); // -3 to +3 radians per second
     m_CurrentRotation = 0.0f;
 
     // Variable fragment intensity for variety
-    m_FragmentIntensity = Window::Random(80, 120) * 0.01f; // 0.8 to 1.2
+    m_FragmentIntensity = Random::Int(Random::STREAM_EFFECTS, 80, 120) * 0.01f; // 0.8 to 1.2
 }
 
 void PlayerExplosionLine::update(double frame) {
@@ -84,18 +85,7 @@ void PlayerExplosionLine::draw() {
         // Calculate catastrophic explosion colors
         Color fragmentColor = calculateCatastrophicColor();
 
-        // Draw multiple layers for maximum visual impact
-        // Massive outer explosion aura (for catastrophic feel)
-        Color outerAura = fragmentColor;
-        outerAura.alpha = outerAura.alpha / 6;
-        Window::DrawVolumetricLineWithBloom(&newLine, outerAura, m_CurrentThickness * 4.0f, 2.5f);
-
-        // Large middle explosion layer
-        Color middleExplosion = fragmentColor;
-        middleExplosion.alpha = middleExplosion.alpha / 3;
-        Window::DrawVolumetricLineWithBloom(&newLine, middleExplosion, m_CurrentThickness * 2.5f, 2.0f);
-
-        // Bright inner fragment core
+        // Bright fragment core; the post-process bloom supplies the surrounding aura
         Color innerCore = fragmentColor;
         innerCore.alpha = (int)(innerCore.alpha * 1.2f); // Extra bright
         if (innerCore.alpha > 255)
@@ -106,11 +96,6 @@ void PlayerExplosionLine::draw() {
         if (m_ExplosionPhase < 0.5f) {
             drawCatastrophicArcs(fragmentColor);
         }
-
-        // Add debris sparks throughout the explosion
-        if (m_ExplosionPhase < 0.8f) {
-            drawDebrisSparks(fragmentColor);
-        }
     }
 }
 
@@ -231,10 +216,10 @@ void PlayerExplosionLine::drawCatastrophicArcs(const Color& baseColor) {
 
     if (lineLength > 8.0f) {
         // Create 3-6 violent arcs
-        int numArcs = Window::Random(3, 6);
+        int numArcs = Random::Int(Random::STREAM_DRAW, 3, 6);
 
         for (int i = 0; i < numArcs; i++) {
-            float t = Window::Random(10, 90) / 100.0f;
+            float t = Random::Int(Random::STREAM_DRAW, 10, 90) / 100.0f;
             Vector2i arcStart;
             arcStart.x = newLine.start.x + (int)(lineVec.x * t);
             arcStart.y = newLine.start.y + (int)(lineVec.y * t);
@@ -247,7 +232,7 @@ void PlayerExplosionLine::drawCatastrophicArcs(const Color& baseColor) {
 
                 float perpLength = sqrt((float)(perpVec.x * perpVec.x + perpVec.y * perpVec.y));
                 if (perpLength > 0) {
-                    float arcLength = Window::Random(8, 20) * (1.0f - m_ExplosionPhase * 0.5f);
+                    float arcLength = Random::Int(Random::STREAM_DRAW, 8, 20) * (1.0f - m_ExplosionPhase * 0.5f);
                     perpVec.x = (int)(perpVec.x / perpLength * arcLength);
                     perpVec.y = (int)(perpVec.y / perpLength * arcLength);
 
@@ -273,49 +258,4 @@ void PlayerExplosionLine::drawCatastrophicArcs(const Color& baseColor) {
     }
 }
 
-void PlayerExplosionLine::drawDebrisSparks(const Color& baseColor) {
-    // Create small debris particles flying off the main fragment
-    Vector2i lineCenter;
-    lineCenter.x = (newLine.start.x + newLine.end.x) / 2;
-    lineCenter.y = (newLine.start.y + newLine.end.y) / 2;
-
-    // Create 2-4 debris sparks using the new particle shader
-    int numSparks = Window::Random(2, 4);
-
-    for (int i = 0; i < numSparks; i++) {
-        // Random direction from fragment center
-        float sparkAngle = Window::Random(0, 628) * 0.01f; // 0 to 2π
-        float sparkDistance = Window::Random(8, 20) * (1.0f - m_ExplosionPhase * 0.6f);
-
-        Vector2i sparkPosition;
-        sparkPosition.x = lineCenter.x + (int)(cos(sparkAngle) * sparkDistance);
-        sparkPosition.y = lineCenter.y + (int)(sin(sparkAngle) * sparkDistance);
-
-        // Enhanced particle effect for debris sparks
-        Color sparkColor;
-        sparkColor.red = 255;
-        sparkColor.green = 180;
-        sparkColor.blue = 50;
-        sparkColor.alpha = (int)(200 * (1.0f - m_ExplosionPhase));
-
-        float particleSize = 4.0f + (1.0f - m_ExplosionPhase) * 4.0f; // 4-8 pixels
-        float intensity = 1.2f * (1.0f - m_ExplosionPhase * 0.7f);
-        
-        Window::DrawParticleEffect(&sparkPosition, particleSize, intensity, sparkColor);
-        
-        // Keep some volumetric lines for variety
-        if (i % 2 == 0) {
-            Vector2i sparkEnd;
-            sparkEnd.x = lineCenter.x + (int)(cos(sparkAngle) * sparkDistance * 0.5f);
-            sparkEnd.y = lineCenter.y + (int)(sin(sparkAngle) * sparkDistance * 0.5f);
-
-            Line sparkLine;
-            sparkLine.start = lineCenter;
-            sparkLine.end = sparkEnd;
-
-            Window::DrawVolumetricLineWithBloom(&sparkLine, sparkColor, 0.8f, 0.6f);
-        }
-    }
-}
-
 } // namespace omegarace
@@ -42,7 +42,6 @@ class PlayerExplosionLine : public Entity {
     float calculateFragmentScale();
     void updateThicknessAnimation();
     void drawCatastrophicArcs(const Color& baseColor);
-    void drawDebrisSparks(const Color& baseColor);
 };
 
 } // namespace omegarace
@@ -1,4 +1,6 @@
 #include "PlayerShip.h"
+#include "ParticleSystem.h"
+#include "Random.h"
 
 namespace omegarace {
 
@@ -221,6 +223,20 @@ void PlayerShip::setExplosion(const Vector2i& location) {
     for (int line = 0; line < 12; line++) {
         pExplosionLines[line]->initialize(newPlayerLines[line], location);
     }
+
+    // Debris sparks flying off the wreck for most of the explosion
+    ParticleSystem::Burst debris;
+    debris.origin = Vector2f((float)location.x, (float)location.y);
+    debris.palette = ParticleSystem::PALETTE_SPARK;
+    debris.count = 32;
+    debris.angleJitter = 6.28318f;
+    debris.minSpeed = 10.0f;
+    debris.maxSpeed = 40.0f;
+    debris.minLife = 1.4f;
+    debris.maxLife = 2.4f;
+    debris.minSize = 4.0f;
+    debris.maxSize = 8.0f;
+    ParticleSystem::Emit(debris);
 }
 
 void PlayerShip::initializeLines() {
@@ -315,11 +331,16 @@ void PlayerShip::drawEngineParticles() {
     engineCenter.x = (newThrustLines[0].start.x + newThrustLines[1].start.x) / 2;
     engineCenter.y = (newThrustLines[0].start.y + newThrustLines[1].start.y) / 2;
 
+    // Random particle directions (mostly backward) and lengths, rolled for all four trails at once
+    float particleAngles[4];
+    float particleLengths[4];
+    Random::Fill(Random::STREAM_DRAW, particleAngles, 4, -0.3f, 0.3f); // ±0.3 radians
+    Random::Fill(Random::STREAM_DRAW, particleLengths, 4, 3.0f, 8.0f);
+
     // Create 3-5 small particle trails
     for (int i = 0; i < 4; i++) {
-        // Random particle direction (mostly backward)
-        float particleAngle = Window::Random(-30, 30) * 0.01f; // ±0.3 radians
-        float particleLength = Window::Random(3, 8);
+        float particleAngle = particleAngles[i];
+        float particleLength = particleLengths[i];
 
         Vector2i particleEnd;
         particleEnd.x = engineCenter.x + (int)(cos(particleAngle) * particleLength);
@@ -22,6 +22,8 @@ StatusDisplay::StatusDisplay() {
     m_ScoreText[1] = "PLAYER SCORE";
 
     m_State = APP_START;
+    m_HudLayer = Window::CreateRetainedLayer("HUD");
+    m_Dirty = true;
     m_GameOverLocation.x = Window::GetWindowSize().x * 0.38;
     m_GameOverLocation.y = Window::GetWindowSize().y / 2 - 30;
     m_InstructionsLocation.x = Window::GetWindowSize().x * 0.25;
@@ -86,9 +88,27 @@ void StatusDisplay::initialize() {
 
     pNumber->initializeNumberLine();
     pLetter->initializeLetterLine();
+    m_Dirty = true;
 }
 
 void StatusDisplay::draw() {
+    if (m_HudLayer < 0) {
+        drawContent();
+        return;
+    }
+
+    // Re-render the cached HUD only when something it shows has changed
+    if (m_Dirty) {
+        Window::BeginRetainedLayer(m_HudLayer);
+        drawContent();
+        Window::EndRetainedLayer();
+        m_Dirty = false;
+    }
+
+    Window::DrawRetainedLayer(m_HudLayer);
+}
+
+void StatusDisplay::drawContent() {
     int size = 8;
 
     switch (m_State) {
@@ -115,15 +135,24 @@ void StatusDisplay::update() {
 }
 
 void StatusDisplay::setScore(int score) {
-    m_Score = score;
+    if (score != m_Score) {
+        m_Score = score;
+        m_Dirty = true;
+    }
 }
 
 void StatusDisplay::setShip(int ship) {
-    m_Ships = ship;
+    if (ship != m_Ships) {
+        m_Ships = ship;
+        m_Dirty = true;
+    }
 }
 
 void StatusDisplay::setState(GAME_STATE s) {
-    m_State = s;
+    if (s != m_State) {
+        m_State = s;
+        m_Dirty = true;
+    }
 }
 
 StatusDisplay::GAME_STATE StatusDisplay::getState() const {
@@ -139,6 +168,7 @@ void StatusDisplay::newGame() {
     m_Score = 0;
     m_Ships = 0;
     m_State = APP_PLAYING;
+    m_Dirty = true;
 }
 
 void StatusDisplay::drawTitle() {
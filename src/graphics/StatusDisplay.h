@@ -28,6 +28,7 @@ class StatusDisplay : Common {
     void newGame();
 
   private:
+    void drawContent();
     void drawTitle();
     void drawGameOver();
     void drawInstructions();
@@ -36,6 +37,8 @@ class StatusDisplay : Common {
     void saveHighScore();
 
     GAME_STATE m_State;
+    int m_HudLayer; // Retained layer holding the cached HUD, -1 when drawn directly
+    bool m_Dirty;   // HUD contents changed since the layer was last rendered
     int m_Score;
     int m_HighScore;
     int m_Ships;
@@ -69,23 +69,7 @@ void TriShip::draw() {
 
     switch (m_Mode) {
         case TriShipMode::ENEMY: {
-            // Draw multiple layers for menacing depth effect
-
-            // Outer threat aura (largest, dimmest)
-            Color auraColor = m_ThreatColor;
-            auraColor.alpha = (int)(auraColor.alpha * 0.4f * m_PulseIntensity);
-            for (int line = 0; line < 3; line++) {
-                Window::DrawVolumetricLineWithBloom(&newTriangle[line], auraColor, 4.5f * m_ThreatLevel, 1.2f);
-            }
-
-            // Middle menacing glow
-            Color glowColor = m_ThreatColor;
-            glowColor.alpha = (int)(glowColor.alpha * 0.7f * m_PulseIntensity);
-            for (int line = 0; line < 3; line++) {
-                Window::DrawVolumetricLineWithBloom(&newTriangle[line], glowColor, 3.0f * m_ThreatLevel, 1.0f);
-            }
-
-            // Core ship structure (brightest)
+            // Core ship structure (brightest); the post-process bloom supplies the menacing glow
             for (int line = 0; line < 3; line++) {
                 Window::DrawVolumetricLineWithBloom(&newTriangle[line], m_CoreColor, 2.0f, 0.8f);
             }
@@ -255,21 +239,7 @@ void TriShip::drawMineEffects() {
     // Create aggressive warning pulse for mines
     m_MineWarningIntensity = 0.6f + sin(m_AnimationTime * 4.0f) * 0.4f; // Fast warning pulse
 
-    // Outer danger aura - large and alarming
-    Color outerWarning = m_WarningColor;
-    outerWarning.alpha = (int)(outerWarning.alpha * 0.4f * m_MineWarningIntensity);
-    for (int line = 0; line < 3; line++) {
-        Window::DrawVolumetricLineWithBloom(&newTriangle[line], outerWarning, 6.0f, 0.8f);
-    }
-
-    // Middle warning layer
-    Color middleWarning = m_WarningColor;
-    middleWarning.alpha = (int)(middleWarning.alpha * 0.7f * m_MineWarningIntensity);
-    for (int line = 0; line < 3; line++) {
-        Window::DrawVolumetricLineWithBloom(&newTriangle[line], middleWarning, 3.5f, 0.6f);
-    }
-
-    // Core danger indicator - bright and pulsing
+    // Core danger indicator - bright and pulsing; the post-process bloom supplies the warning aura
     for (int line = 0; line < 3; line++) {
         Window::DrawVolumetricLineWithBloom(&newTriangle[line], m_DangerColor, 2.0f, 0.4f);
     }
@@ -305,21 +275,7 @@ void TriShip::drawDoubleMineEffects() {
     // Double mine is even more dangerous - more intense effects
     m_MineWarningIntensity = 0.7f + sin(m_AnimationTime * 5.5f) * 0.3f; // Even faster pulse
 
-    // Massive outer danger aura
-    Color extremeWarning = m_DangerColor;
-    extremeWarning.alpha = (int)(extremeWarning.alpha * 0.5f * m_MineWarningIntensity);
-    for (int line = 0; line < 3; line++) {
-        Window::DrawVolumetricLineWithBloom(&newTriangle[line], extremeWarning, 8.0f, 1.0f);
-    }
-
-    // Bright warning layer
-    Color brightWarning = m_WarningColor;
-    brightWarning.alpha = (int)(brightWarning.alpha * 0.8f * m_MineWarningIntensity);
-    for (int line = 0; line < 3; line++) {
-        Window::DrawVolumetricLineWithBloom(&newTriangle[line], brightWarning, 5.0f, 0.7f);
-    }
-
-    // Extreme danger core
+    // Extreme danger core; the post-process bloom supplies the danger aura
     Color extremeDanger = m_DangerColor;
     extremeDanger.alpha = 255; // Always maximum intensity
     for (int line = 0; line < 3; line++) {
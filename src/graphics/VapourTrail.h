@@ -1,13 +1,19 @@
 #pragma once
 
 #include "Window.h"
+#include <array>
+#include <cstdint>
 
 namespace omegarace {
 
+// Points are kept in a fixed ring at the longest trail length; the trail length only picks how many of
+// the newest points are drawn. Each point remembers the update it was laid down on and its alpha is
+// worked out from that age at draw time, so an update touches a single point.
 class VapourTrail {
   public:
+    static constexpr int MAX_TRAIL_LENGTH = 100;
+
     VapourTrail(int trailLength = 25);
-    ~VapourTrail();
 
     void setActive(bool active);
     bool isActive() const {
@@ -30,17 +36,21 @@ class VapourTrail {
     void clearTrail();
 
   private:
+    float alphaAt(uint32_t birthTick) const;
+
     bool m_Active;
     int m_TrailLength;
-    int m_TrailIndex;
+    int m_TrailIndex; // Next ring slot to write
+    int m_PointCount; // Points written since the last clear, up to MAX_TRAIL_LENGTH
+    uint32_t m_Tick;  // Counts update calls; points fade per update, not per frame drawn
     int m_UpdateCounter;
     int m_UpdateFrequency;
     float m_FadeRate;
     float m_MaxThickness;
     float m_MinThickness;
 
-    Vector2f* m_TrailPoints;
-    float* m_TrailAlpha;
+    std::array<Vector2f, MAX_TRAIL_LENGTH> m_TrailPoints;
+    std::array<uint32_t, MAX_TRAIL_LENGTH> m_BirthTick;
     Color m_TrailColor;
 };
 
@@ -14,7 +14,6 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <stdio.h>
@@ -22,6 +21,7 @@
 #include <string>
 #include <thread>
 #include <time.h>
+#include <vector>
 
 namespace omegarace {
 
@@ -30,10 +30,12 @@ struct DistortionSource;
 
 class Window {
   public:
-    static void Init(int width, int height, std::string title = "OmegaRace");
+    // Headless runs use bgfx's Noop renderer with no SDL window and record every Draw* call
+    static void Init(int width, int height, std::string title = "OmegaRace", bool headless = false);
     static void Quit();
     static void BeginFrame();
-    static void EndFrame();
+    static void EndFrame();     // PresentFrame, then advance the input state for the next frame
+    static void PresentFrame(); // Submit the frame's draws and kick bgfx
     static Rectangle Box();
     static void logError(std::ostream& os, const std::string& msg);
 
@@ -51,22 +53,125 @@ class Window {
     static void DrawElectricBarrierLine(Line* LineLocation, const Color& LineColor, 
                                        float pulseSpeed = 15.0f, float thickness = 3.0f, float fadeTime = 0.5f);
 
+    // Persistent geometry owned by the caller, built once and re-submitted without re-upload
+    static bgfx::VertexBufferHandle CreateStaticLineBuffer(const Line* lines, const Color* colors, int count);
+    static void CreateStaticElectricBarrier(const Line* lines, const Color* colors, int count, float thickness,
+                                            bgfx::VertexBufferHandle& vertexBuffer,
+                                            bgfx::IndexBufferHandle& indexBuffer);
+    static void DrawStaticLines(bgfx::VertexBufferHandle vertexBuffer, uint32_t startVertex, uint32_t numVertices);
+    static void DrawStaticElectricBarrierLine(bgfx::VertexBufferHandle vertexBuffer,
+                                              bgfx::IndexBufferHandle indexBuffer, int line, float pulseSpeed,
+                                              float thickness, float fadeTime);
+
+    // Segment-font glyph cache. Letter and Number register their segment tables once; each glyph is
+    // then a single instance {location, scale, lit-segment mask, color} drawn in one submit per font.
+    enum GlyphFont { GLYPH_FONT_LETTERS = 0, GLYPH_FONT_DIGITS, GLYPH_FONT_COUNT };
+    static void CreateGlyphFont(GlyphFont font, const Vector2i* segmentStart, const Vector2i* segmentEnd,
+                                int segmentCount);
+    static bool HasGlyphFont(GlyphFont font);
+    static void DrawGlyph(GlyphFont font, const Vector2i& location, int scale, uint32_t segmentMask,
+                          const Color& color);
+
+    // Retained layers: slow-changing overlays (HUD, pause panel) are recorded into an offscreen
+    // target only between BeginRetainedLayer/EndRetainedLayer and composited every frame as one quad.
+    // CreateRetainedLayer returns -1 when no offscreen target is available; draw directly in that case.
+    static int CreateRetainedLayer(const std::string& name);
+    static void BeginRetainedLayer(int layer);
+    static void EndRetainedLayer();
+    static void DrawRetainedLayer(int layer);
+    static uint32_t GetRetainedLayerRenderCount(int layer);
+
     // Enhanced shader-based effects for Geometry Wars style
     static void DrawNeonGrid(float gridSize = 32.0f, float lineWidth = 0.02f, float glowIntensity = 1.0f, 
                             const Color& gridColor = {0, 100, 255, 80}, Vector2f* playerPos = nullptr, float warpIntensity = 0.0f);
-    static void ResetGridDistortion(); // Reset grid distortion when player is inactive
+    static void ResetGridDistortion(); // Nothing to do: each grid draw carries its own distortion
     static void DrawParticleEffect(Vector2i* position, float size = 8.0f, float intensity = 1.0f, 
                                   const Color& particleColor = {255, 255, 255, 255});
     
-    // Smoky vapor trail rendering with advanced shader effects
-    static void DrawVaporTrailSegment(const Vector2f& start, const Vector2f& end, float width, 
-                                     float trailPosition, const Color& trailColor, float alpha = 1.0f);
+    // Stateless particle bursts: one instance per spawn record, every particle's position and colour
+    // derived in the vertex shader from the record and the particle clock. Drawn in one submit.
+    static constexpr int MAX_BURST_PARTICLES = 32;
+    struct ParticleBurstInstance {
+        float originX, originY, startTime, seed;
+        float count, palette, gravity, angleJitter;
+        float minSpeed, speedRange, minLife, lifeRange;
+        float minSize, sizeRange, pad0, pad1;
+    };
+    static void DrawParticleBursts(const ParticleBurstInstance* bursts, int count, float time);
+
+    // Smoky vapor trail rendering with advanced shader effects. The trail is read from a ring buffer
+    // starting at its oldest point and appended to a triangle strip drawn in one submit per draw group.
+    static void DrawVaporTrail(const Vector2f* points, const float* alphas, int count, int oldest,
+                               const Color& trailColor, float minWidth, float maxWidth);
     static void DrawShieldGlow(Vector2i* center, float radius = 50.0f, float energy = 1.0f, 
                                const Color& shieldColor = {100, 200, 255, 180});
     static void ApplyPostProcessBloom(float threshold = 0.5f, float intensity = 1.5f, float radius = 0.01f);
 
+    // Draw layers, lowest first. Game-view draws are recorded into a frame-wide draw list and replayed
+    // at EndFrame sorted by layer, then by program wherever blending allows, so layering is kept while
+    // draws sharing a program are bound once.
+    enum DrawLayer { DRAW_LAYER_GRID = 0, DRAW_LAYER_TRAILS, DRAW_LAYER_WORLD, DRAW_LAYER_HUD };
+    static void SetDrawLayer(DrawLayer layer);
+    struct DrawListStats {
+        uint32_t commands = 0;
+        uint32_t programSwitchesRecorded = 0;  // Switches had the commands been submitted as recorded
+        uint32_t programSwitchesSubmitted = 0; // Switches after sorting
+    };
+    static DrawListStats GetDrawListStats();
+
+    // Pipelined rendering. Between BeginCapture and EndCapture the calling thread's drawing calls (the
+    // Draw* calls, SetDrawLayer, ApplyPostProcessBloom and the retained layer calls) are stored in the
+    // snapshot with their arguments instead of reaching bgfx. A snapshot is then an immutable picture of
+    // one tick, replayed by ReplaySnapshot while the simulation thread moves on. BeginDrawGroup splits
+    // the snapshot into entity groups; each group is replayed on a job worker into its own batches and
+    // draw list and submitted through its own bgfx::Encoder, and the frame keeps the groups in capture
+    // order. Outside a capture BeginDrawGroup does nothing. Resources are still created on the main thread.
+    class FrameSnapshot {
+      public:
+        void clear();
+        bool empty() const { return m_Bytes.empty(); }
+
+      private:
+        friend class Window;
+        template <typename... Args>
+        void record(uint8_t op, const Args&... args);
+        template <typename T>
+        void recordArray(const T* values, int count);
+        void append(const void* data, size_t size);
+
+        // Where a group starts, with the layer and retained layer its first draw is recorded into
+        struct Group {
+            size_t offset;
+            DrawLayer layer;
+            int retainedLayer;
+        };
+
+        std::vector<uint8_t> m_Bytes; // Keeps its capacity from frame to frame
+        std::vector<Group> m_Groups;
+        DrawLayer m_Layer = DRAW_LAYER_WORLD; // As of the last recorded call
+        int m_RetainedLayer = -1;
+    };
+    static void BeginCapture(FrameSnapshot& snapshot);
+    static void EndCapture();
+    static void BeginDrawGroup();
+    static void ReplaySnapshot(const FrameSnapshot& snapshot);
+
+    // Headless draw recording: one record per Draw* call this frame, kept until the next BeginFrame.
+    // Uniforms are those of the call's own submit; batched calls carry none of their own.
+    static constexpr int MAX_DRAW_UNIFORMS = 3;
+    struct DrawRecord {
+        const char* type = "";
+        uint32_t vertexCount = 0;
+        uint16_t program = bgfx::kInvalidHandle;
+        int numUniforms = 0;
+        bgfx::UniformHandle uniforms[MAX_DRAW_UNIFORMS];
+        float uniformValues[MAX_DRAW_UNIFORMS][4];
+    };
+    static bool IsHeadless();
+    static const std::vector<DrawRecord>& GetDrawRecords();
+    static void DumpDrawRecords(std::ostream& os);
+
     static Vector2i GetWindowSize();
-    static int Random(int Min, int Max);
 
     static std::string dataPath();
 
@@ -97,11 +202,12 @@ class Window {
     static bgfx::ProgramHandle mGridProgram;
     static bgfx::ProgramHandle mParticleProgram;
     static bgfx::ProgramHandle mShieldProgram;
-    static bgfx::ProgramHandle mPostProcessProgram;
     static bgfx::ProgramHandle mVaporTrailProgram;
     static bgfx::ProgramHandle mElectricBarrierProgram;
-    static bgfx::FrameBufferHandle mBloomFrameBuffer;
-    static bgfx::TextureHandle mBloomTexture;
+    static bgfx::ProgramHandle mVolumetricInstancedProgram;
+    static bgfx::ProgramHandle mGlyphProgram;
+    static bgfx::ProgramHandle mCompositeProgram;
+    static bgfx::ProgramHandle mParticleBurstProgram;
     static bgfx::UniformHandle mBloomParams;
     static bgfx::UniformHandle mGridParams;
     static bgfx::UniformHandle mGridPlayerPos; // NEW: For grid distortion around player
@@ -110,6 +216,8 @@ class Window {
     static bgfx::UniformHandle mVaporParams;
     static bgfx::UniformHandle mWarpParams;
     static bgfx::UniformHandle mElectricParams;
+    static bgfx::UniformHandle mTextureSampler;
+    static bgfx::UniformHandle mBurstParams;
 
     // Scaling for aspect ratio preservation
     static float mRenderScale;
@@ -126,12 +234,216 @@ class Window {
 
     static bool mShouldQuit;
 
+    // Headless mode and its per-frame draw records
+    static bool mHeadless;
+    static uint32_t mFrameNumber;
+    static std::vector<DrawRecord> mDrawRecords; // Every recorder's, in group order, once the frame is presented
+    static std::vector<std::string> mProgramNames;
+    static void RecordDrawCall(const char* type, uint32_t vertexCount, bgfx::ProgramHandle program);
+    static void GetWindowPixelSize(int& width, int& height); // Backbuffer pixels, not window points
+
     // BGFX initialization and management
     static bool InitializeBGFX();
     static void SetupRenderStates();
     static void CreateBloomResources();
+    static void CreateBloomChain();
     static void ShutdownBGFX();
 
+    // Frame-scoped line batch: DrawLine appends to its recorder's and the batch is flushed as one transient
+    // buffer (one submit per run of identical state) before alpha-blended or otherwise order-dependent
+    // submits, on layer and view changes, and at the end of the group or frame. Additive draws interleave
+    // with it freely.
+    struct LineVertex {
+        float x, y;
+        float r, g, b, a;
+    };
+    struct LineBatchRun {
+        uint64_t state;
+        uint32_t first;
+        uint32_t count;
+    };
+    static bgfx::VertexLayout mLineLayout;
+    static bgfx::VertexLayout mQuadLayout;
+    static void BatchLine(float x0, float y0, float x1, float y1, const Color& color, uint64_t state);
+    static void FlushLineBatch();
+
+    // Instanced volumetric lines: a static unit quad plus one instance per line, extruded in the
+    // vertex shader. Instances are additive, so they are flushed alongside the line batch.
+    struct VolumetricLineInstance {
+        float startX, startY, endX, endY;
+        float r, g, b, a;
+        float thickness, bloomIntensity, pad0, pad1;
+    };
+    static bgfx::VertexLayout mUnitQuadLayout;
+    static bgfx::VertexBufferHandle mUnitQuadVertexBuffer;
+    static bgfx::IndexBufferHandle mUnitQuadIndexBuffer;
+    static bgfx::VertexLayout mParticleBurstLayout;
+    static bgfx::VertexBufferHandle mParticleBurstVertexBuffer;
+    static bgfx::IndexBufferHandle mParticleBurstIndexBuffer;
+    static void CreateInstancingResources();
+    static void FlushVolumetricBatch();
+
+    // Glyph fonts: segment end points kept on the CPU for the non-instanced fallback
+    struct GlyphInstance {
+        float x, y, scale, segmentMask;
+        float r, g, b, a;
+    };
+    struct GlyphFontData {
+        std::vector<Vector2i> segmentStart;
+        std::vector<Vector2i> segmentEnd;
+        bgfx::VertexBufferHandle vertexBuffer = BGFX_INVALID_HANDLE;
+    };
+    static bgfx::VertexLayout mGlyphLayout;
+    static GlyphFontData mGlyphFonts[GLYPH_FONT_COUNT];
+    static void FlushGlyphBatch();
+
+    // Vapor trails: one triangle strip for every trail in the group, runs joined by degenerate triangles
+    struct VaporTrailVertex {
+        float x, y;
+        float r, g, b, a;
+        float u, v; // u = position along trail, v = position across width
+    };
+    static void FlushVaporBatch();
+    static void FlushBatches();
+
+    // Retained layers render in the views between the background and main views
+    static constexpr int MAX_RETAINED_LAYERS = 4;
+    static constexpr bgfx::ViewId RETAINED_LAYER_FIRST_VIEW = 1;
+    struct RetainedLayer {
+        std::string name;
+        bgfx::FrameBufferHandle frameBuffer = BGFX_INVALID_HANDLE;
+        std::atomic<uint32_t> renderCount{0}; // Groups replaying on different workers may both count
+        std::atomic<uint32_t> compositeCount{0};
+    };
+    static RetainedLayer mRetainedLayers[MAX_RETAINED_LAYERS];
+    static int mRetainedLayerCount;
+
+    // Bloom chain: background and main views render into an offscreen scene target, then a bright
+    // pass, dual-filter down/up blur over half/quarter/eighth resolution and a composite to the backbuffer
+    static constexpr int BLOOM_LEVELS = 3;
+    static bool mBloomEnabled;
+    static bgfx::FrameBufferHandle mSceneFrameBuffer;
+    static bgfx::FrameBufferHandle mBloomFrameBuffers[BLOOM_LEVELS];
+    static bgfx::ProgramHandle mBloomBrightProgram;
+    static bgfx::ProgramHandle mBloomDownProgram;
+    static bgfx::ProgramHandle mBloomUpProgram;
+    static bgfx::ProgramHandle mBloomCombineProgram;
+    static bgfx::UniformHandle mBloomPassParams;
+    static bgfx::UniformHandle mBloomSampler;
+
+    // Draw list. A command captures everything bgfx would otherwise take through its set* calls; transient
+    // and instance buffers stay valid until bgfx::frame, so replaying them at EndFrame is safe. The sort
+    // key is, high to low: view, layer, blend group, program, record order. Additive draws commute, so
+    // only a non-additive command opens a new blend group and keeps its place relative to its neighbours.
+    static constexpr int MAX_DRAW_TEXTURES = 2;
+    struct DrawCommand {
+        bgfx::ViewId view = 0;
+        bgfx::ProgramHandle program = BGFX_INVALID_HANDLE;
+        uint64_t state = 0;
+        bool transientVertices = false;
+        bool transientIndices = false;
+        bool instanced = false;
+        bgfx::TransientVertexBuffer transientVertexBuffer;
+        bgfx::TransientIndexBuffer transientIndexBuffer;
+        bgfx::VertexBufferHandle vertexBuffer = BGFX_INVALID_HANDLE;
+        bgfx::IndexBufferHandle indexBuffer = BGFX_INVALID_HANDLE;
+        uint32_t startVertex = 0;
+        uint32_t numVertices = UINT32_MAX;
+        uint32_t startIndex = 0;
+        uint32_t numIndices = UINT32_MAX;
+        bgfx::InstanceDataBuffer instanceDataBuffer;
+        int numUniforms = 0;
+        bgfx::UniformHandle uniforms[MAX_DRAW_UNIFORMS];
+        float uniformValues[MAX_DRAW_UNIFORMS][4];
+        int numTextures = 0;
+        bgfx::UniformHandle samplers[MAX_DRAW_TEXTURES];
+        bgfx::TextureHandle textures[MAX_DRAW_TEXTURES];
+
+        void setVertexBuffer(const bgfx::TransientVertexBuffer* tvb, uint32_t start = 0, uint32_t num = UINT32_MAX);
+        void setVertexBuffer(bgfx::VertexBufferHandle handle, uint32_t start = 0, uint32_t num = UINT32_MAX);
+        void setIndexBuffer(const bgfx::TransientIndexBuffer* tib);
+        void setIndexBuffer(bgfx::IndexBufferHandle handle, uint32_t start = 0, uint32_t num = UINT32_MAX);
+        void setInstanceDataBuffer(const bgfx::InstanceDataBuffer* idb);
+        void setUniform(bgfx::UniformHandle uniform, const float* value);
+        void setTexture(bgfx::UniformHandle sampler, bgfx::TextureHandle texture);
+        void setState(uint64_t newState) { state = newState; }
+    };
+    static DrawListStats mDrawListStats;
+    static uint32_t mDrawListFrames;
+    static void Submit(DrawCommand& command, bgfx::ViewId view, bgfx::ProgramHandle program);
+    static void Submit(DrawCommand& command, bgfx::ViewId view, bgfx::ProgramHandle program, DrawLayer layer);
+
+    // Everything a draw group builds up while it is recorded: its batches, draw list, layer and target
+    // view. Recorder 0 takes the calling thread's direct draws; a replayed snapshot group g records into
+    // recorder g on whichever worker runs it, so groups never share state. The group index sits in the
+    // sort key between layer and blend group, and the key's upper half goes to bgfx as the draw's depth
+    // in DepthAscending views: groups submitted through different encoders still come out in layer, then
+    // group, then blend group order, and bgfx itself orders the commuting draws of a blend group by program.
+    static constexpr int MAX_DRAW_GROUPS = 16; // Also the encoder limit bgfx is initialised with
+    struct DrawRecorder {
+        std::vector<LineVertex> lineBatch;
+        std::vector<LineBatchRun> lineBatchRuns;
+        std::vector<VolumetricLineInstance> volumetricBatch;
+        std::vector<GlyphInstance> glyphInstances[GLYPH_FONT_COUNT];
+        std::vector<VaporTrailVertex> vaporBatch;
+        std::vector<uint16_t> vaporIndices;
+
+        std::vector<DrawCommand> drawList;
+        std::vector<uint64_t> drawKeys;
+        uint32_t group = 0;
+        DrawLayer drawLayer = DRAW_LAYER_WORLD;
+        uint32_t blendGroup = 0;
+        bgfx::ViewId targetView = 0; // Main view or a retained layer
+        int activeRetainedLayer = -1;
+        DrawListStats stats;         // Of the lists submitted since the frame was last presented
+
+        std::vector<DrawRecord> drawRecords; // Headless only
+        int openDrawRecord = -1;
+    };
+    static DrawRecorder mRecorders[MAX_DRAW_GROUPS];
+    static DrawRecorder& Recorder(); // The calling thread's
+    static void StartRecorder(DrawRecorder& recorder, uint32_t group, DrawLayer layer, int retainedLayer);
+    static void FlushDrawList(DrawRecorder& recorder, bgfx::Encoder* encoder); // Sorts and submits the list
+    static void ReplayGroup(const FrameSnapshot& snapshot, int group);
+
+    // bgfx's transient and instance buffers are shared by every recorder, so allocation is serialised.
+    // Each returns false, or zero instances, when the buffers are exhausted.
+    static std::mutex mTransientMutex;
+    static bool AllocTransientVertices(bgfx::TransientVertexBuffer* tvb, uint32_t numVertices,
+                                       const bgfx::VertexLayout& layout);
+    static bool AllocTransientBuffers(bgfx::TransientVertexBuffer* tvb, uint32_t numVertices,
+                                      const bgfx::VertexLayout& layout, bgfx::TransientIndexBuffer* tib,
+                                      uint32_t numIndices);
+    static uint32_t AllocInstances(bgfx::InstanceDataBuffer* idb, uint32_t numInstances, uint16_t stride);
+
+    // Textured quad from (0, 0) to (width, height) with render-target texture coordinates
+    static void SubmitTexturedQuad(DrawCommand& command, bgfx::ViewId view, float width, float height,
+                                   bgfx::ProgramHandle program);
+
+    // Seconds since the first shader-animated draw
+    static float ShaderTime();
+
+    enum SnapshotOp : uint8_t {
+        SNAPSHOT_LINE,
+        SNAPSHOT_POINT,
+        SNAPSHOT_RECT,
+        SNAPSHOT_VOLUMETRIC_LINE,
+        SNAPSHOT_ELECTRIC_LINE,
+        SNAPSHOT_STATIC_LINES,
+        SNAPSHOT_STATIC_ELECTRIC_LINE,
+        SNAPSHOT_GLYPH,
+        SNAPSHOT_BEGIN_RETAINED_LAYER,
+        SNAPSHOT_END_RETAINED_LAYER,
+        SNAPSHOT_DRAW_RETAINED_LAYER,
+        SNAPSHOT_NEON_GRID,
+        SNAPSHOT_PARTICLE_EFFECT,
+        SNAPSHOT_PARTICLE_BURSTS,
+        SNAPSHOT_VAPOR_TRAIL,
+        SNAPSHOT_SHIELD_GLOW,
+        SNAPSHOT_BLOOM,
+        SNAPSHOT_DRAW_LAYER
+    };
+
     // Shader loading functions
     static bgfx::ProgramHandle loadProgram(const char* vsName, const char* fsName);
     static bgfx::ShaderHandle loadShader(const char* name);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Platform.h"
 #include "Types.h"
 #include <SDL2/SDL.h>
 #include <chrono>
@@ -51,4 +52,21 @@ private:
     static SDL_GameControllerAxis mapGamepadAxis(int axis);
 };
 
+// Binds the simulation's InputSource to the keyboard and gamepad state above
+class DeviceInputSource : public InputSource {
+public:
+    bool isKeyPressed(int key) override { return InputManager::IsKeyPressed(key); }
+    bool isKeyDown(int key) override { return InputManager::IsKeyDown(key); }
+    bool isGamepadButtonPressed(int gamepad, int button) override {
+        return InputManager::IsGamepadButtonPressed(gamepad, button);
+    }
+    bool isGamepadButtonDown(int gamepad, int button) override {
+        return InputManager::IsGamepadButtonDown(gamepad, button);
+    }
+    float getGamepadAxisMovement(int gamepad, int axis) override {
+        return InputManager::GetGamepadAxisMovement(gamepad, axis);
+    }
+    bool isControllerConnected() override { return InputManager::IsControllerConnected(); }
+};
+
 } // namespace omegarace
@@ -1,8 +1,74 @@
 #include "core/Game.h"
+#include "core/HeadlessRunner.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 
-int main(int, char**) {
+int main(int argc, char** argv) {
     omegarace::Game game;
 
+    // --noop-renderer [--dump-draws] [--frames N]: render without a window or GPU
+    // --headless [--ticks N]: step the simulation only, as fast as possible
+    // --record FILE / --replay FILE: save this session's input, or play a saved one back
+    // --pipelined: simulate the next frame on a worker while the last one renders
+    bool noopRenderer = false;
+    bool headless = false;
+    unsigned long long tickLimit = 0;
+    std::string recordPath;
+    std::string replayPath;
+    bool dumpDraws = false;
+    bool pipelined = false;
+    int frameLimit = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--noop-renderer") == 0) {
+            noopRenderer = true;
+        } else if (strcmp(argv[i], "--dump-draws") == 0) {
+            dumpDraws = true;
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frameLimit = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            tickLimit = strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--pipelined") == 0) {
+            pipelined = true;
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    if (!noopRenderer && (dumpDraws || frameLimit > 0)) {
+        std::cerr << "--dump-draws and --frames require --noop-renderer" << std::endl;
+        return 1;
+    }
+    if (!headless && tickLimit > 0) {
+        std::cerr << "--ticks requires --headless" << std::endl;
+        return 1;
+    }
+    if (headless && (noopRenderer || pipelined)) {
+        std::cerr << "--noop-renderer and --pipelined cannot be combined with --headless" << std::endl;
+        return 1;
+    }
+
+    if (headless) {
+        omegarace::HeadlessRunner runner(tickLimit);
+        runner.setInputRecording(recordPath);
+        runner.setInputReplay(replayPath);
+        return runner.run();
+    }
+
+    if (noopRenderer) {
+        game.setHeadlessRendering(dumpDraws, frameLimit);
+    }
+
+    game.setPipelinedRendering(pipelined);
+    game.setInputRecording(recordPath);
+    game.setInputReplay(replayPath);
     return game.OnExecute();
 }
@@ -0,0 +1,24 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_texColor, 0);
+
+uniform vec4 u_bloomPass; // xy: source texel offset, z: threshold, w: intensity
+
+void main()
+{
+    // 4-tap box filter while halving the resolution
+    vec2 offset = u_bloomPass.xy;
+    vec3 color = texture2D(s_texColor, v_texcoord0 + vec2(-offset.x, -offset.y)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(offset.x, -offset.y)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(-offset.x, offset.y)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(offset.x, offset.y)).rgb;
+    color *= 0.25;
+
+    // Keep only what is brighter than the threshold, scaled so the hue is preserved
+    float luminance = dot(color, vec3(0.299, 0.587, 0.114));
+    float contribution = max(luminance - u_bloomPass.z, 0.0) / max(luminance, 0.0001);
+
+    gl_FragColor = vec4(color * contribution, 1.0);
+}
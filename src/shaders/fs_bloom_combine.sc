@@ -0,0 +1,16 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_texColor, 0);
+SAMPLER2D(s_bloom, 1);
+
+uniform vec4 u_bloomPass; // xy: source texel offset, z: threshold, w: intensity
+
+void main()
+{
+    vec3 scene = texture2D(s_texColor, v_texcoord0).rgb;
+    vec3 bloom = texture2D(s_bloom, v_texcoord0).rgb;
+
+    gl_FragColor = vec4(scene + bloom * u_bloomPass.w, 1.0);
+}
@@ -0,0 +1,20 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_texColor, 0);
+
+uniform vec4 u_bloomPass; // xy: source texel offset, z: threshold, w: intensity
+
+void main()
+{
+    // Dual-filter downsample: centre plus four diagonal bilinear taps
+    vec2 offset = u_bloomPass.xy;
+    vec3 color = texture2D(s_texColor, v_texcoord0).rgb * 4.0;
+    color += texture2D(s_texColor, v_texcoord0 - offset).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + offset).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(offset.x, -offset.y)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(-offset.x, offset.y)).rgb;
+
+    gl_FragColor = vec4(color * 0.125, 1.0);
+}
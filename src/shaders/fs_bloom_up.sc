@@ -0,0 +1,23 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_texColor, 0);
+
+uniform vec4 u_bloomPass; // xy: source texel offset, z: threshold, w: intensity
+
+void main()
+{
+    // Dual-filter upsample: eight taps in a tent around the output texel
+    vec2 offset = u_bloomPass.xy;
+    vec3 color = texture2D(s_texColor, v_texcoord0 + vec2(-offset.x * 2.0, 0.0)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(-offset.x, offset.y)).rgb * 2.0;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(0.0, offset.y * 2.0)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(offset.x, offset.y)).rgb * 2.0;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(offset.x * 2.0, 0.0)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(offset.x, -offset.y)).rgb * 2.0;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(0.0, -offset.y * 2.0)).rgb;
+    color += texture2D(s_texColor, v_texcoord0 + vec2(-offset.x, -offset.y)).rgb * 2.0;
+
+    gl_FragColor = vec4(color / 12.0, 1.0);
+}
@@ -0,0 +1,11 @@
+$input v_color0, v_texcoord0
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_texColor, 0);
+
+void main()
+{
+    // Cached layer texel, tinted by the quad color
+    gl_FragColor = texture2D(s_texColor, v_texcoord0) * v_color0;
+}
@@ -0,0 +1,26 @@
+$input v_color0, v_texcoord0, v_texcoord1
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+    // Bloom parameters arrive per instance: x: bloomIntensity, y: bloomRadius, z: bloomThreshold, w: lineThickness
+    float bloomIntensity = v_texcoord1.x;
+
+    // Calculate distance from line center (0.0 = center, 1.0 = edge)
+    float distanceFromCenter = abs(v_texcoord0.y - 0.5) * 2.0;
+
+    // Core line - solid center with reasonable falloff
+    float coreAlpha = 1.0 - smoothstep(0.0, 0.4, distanceFromCenter);
+
+    // Aggressive bloom effect - much stronger glow around the line
+    float bloomFalloff = 1.0 - distanceFromCenter;
+    float aggressiveBloomAlpha = bloomIntensity * 2.0 * bloomFalloff * bloomFalloff * bloomFalloff;
+
+    // Combine core and bloom, then boost intensity
+    float totalAlpha = clamp(max(coreAlpha, aggressiveBloomAlpha) * 3.0, 0.0, 1.0);
+
+    vec3 finalRGB = v_color0.rgb * (2.0 + bloomIntensity);
+
+    gl_FragColor = vec4(finalRGB, totalAlpha);
+}
@@ -0,0 +1,20 @@
+$input a_position, a_texcoord0, i_data0, i_data1
+$output v_color0
+
+#include <bgfx_shader.sh>
+
+// Segment-font glyph instance:
+// a_position:  segment end point in glyph grid units
+// a_texcoord0: x = segment index within the font
+// i_data0:     xy = glyph location, z = grid scale, w = lit-segment bit mask
+// i_data1:     rgba color
+
+void main()
+{
+    float lit = mod(floor(i_data0.w / exp2(a_texcoord0.x)), 2.0);
+    vec2 position = i_data0.xy + a_position * i_data0.z;
+
+    // Unlit segments are moved outside the clip volume so they are never rasterized
+    gl_Position = lit > 0.5 ? mul(u_modelViewProj, vec4(position, 0.0, 1.0)) : vec4(-2.0, -2.0, 0.0, 1.0);
+    v_color0 = i_data1;
+}
@@ -0,0 +1,75 @@
+$input a_position, a_texcoord0, i_data0, i_data1, i_data2, i_data3
+$output v_color0
+
+#include <bgfx_shader.sh>
+
+// Stateless particle burst instance, evaluated entirely from the spawn record:
+// a_position:  streak corner, x = 0..1 along the streak, y = -1..1 across it
+// a_texcoord0: x = particle index within the burst
+// i_data0:     xy = origin, z = spawn time, w = seed
+// i_data1:     x = particle count, y = palette, z = gravity, w = angle jitter
+// i_data2:     x = min speed, y = speed range, z = min life, w = life range
+// i_data3:     x = min size, y = size range
+
+uniform vec4 u_burstParams; // x: particle clock in seconds
+
+#define PALETTE_DUST  0.0
+#define PALETTE_UFO   1.0
+#define PALETTE_SPARK 2.0
+
+float burstHash(float seed, float index, float salt)
+{
+    return fract(sin(seed * 0.0137 + index * 12.9898 + salt * 78.233) * 43758.5453);
+}
+
+vec3 paletteColor(float palette, float lifeRatio)
+{
+    if (palette < PALETTE_UFO - 0.5) {
+        // Gray dust that darkens over its second half
+        return lifeRatio > 0.5 ? vec3_splat((180.0 + 75.0 * lifeRatio) / 255.0)
+                               : vec3_splat((180.0 / 255.0) * (lifeRatio / 0.5));
+    }
+
+    if (palette < PALETTE_SPARK - 0.5) {
+        // White -> cyan -> blue -> purple -> dark
+        if (lifeRatio > 0.8) {
+            return vec3(1.0, 1.0, 1.0);
+        } else if (lifeRatio > 0.6) {
+            return vec3((lifeRatio - 0.6) / 0.2, 1.0, 1.0);
+        } else if (lifeRatio > 0.4) {
+            return vec3(0.0, (lifeRatio - 0.4) / 0.2, 1.0);
+        } else if (lifeRatio > 0.2) {
+            return vec3((128.0 / 255.0) * (1.0 - (lifeRatio - 0.2) / 0.2), 0.0, 1.0);
+        }
+        float transition = lifeRatio / 0.2;
+        return vec3((128.0 / 255.0) * transition, 0.0, transition);
+    }
+
+    // Hot orange spark
+    return vec3(1.0, 200.0 / 255.0, 100.0 / 255.0);
+}
+
+void main()
+{
+    float index = a_texcoord0.x;
+    float seed = i_data0.w;
+    float count = i_data1.x;
+    float age = u_burstParams.x - i_data0.z;
+
+    float angle = (index / count) * 6.28318 + burstHash(seed, index, 1.0) * i_data1.w;
+    float speed = i_data2.x + burstHash(seed, index, 2.0) * i_data2.y;
+    float life = i_data2.z + burstHash(seed, index, 3.0) * i_data2.w;
+    float size = i_data3.x + burstHash(seed, index, 4.0) * i_data3.y;
+    float lifeRatio = 1.0 - age / life;
+
+    vec2 velocity = vec2(cos(angle), sin(angle)) * speed;
+    vec2 center = i_data0.xy + velocity * age + vec2(0.0, 0.5 * i_data1.z * age * age);
+    vec2 position = center + vec2(a_position.x * size, a_position.y);
+
+    // Unused slots and expired particles are moved outside the clip volume
+    bool alive = index < count && age >= 0.0 && lifeRatio > 0.0;
+    gl_Position = alive ? mul(u_modelViewProj, vec4(position, 0.0, 1.0)) : vec4(-2.0, -2.0, 0.0, 1.0);
+
+    float alpha = i_data1.y > PALETTE_SPARK - 0.5 ? 0.7 * lifeRatio : lifeRatio;
+    v_color0 = vec4(paletteColor(i_data1.y, clamp(lifeRatio, 0.0, 1.0)), alpha);
+}
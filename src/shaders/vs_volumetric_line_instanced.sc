@@ -0,0 +1,32 @@
+$input a_position, i_data0, i_data1, i_data2
+$output v_color0, v_texcoord0, v_texcoord1
+
+#include <bgfx_shader.sh>
+
+// Per-instance data:
+// i_data0: xy = line start, zw = line end
+// i_data1: rgba color
+// i_data2: x = thickness, y = bloom intensity
+// a_position is a unit quad: x runs along the line (0-1), y runs across it (0-1)
+
+void main()
+{
+    vec2 lineStart = i_data0.xy;
+    vec2 lineEnd = i_data0.zw;
+    float thickness = i_data2.x;
+    float bloomIntensity = i_data2.y;
+
+    vec2 direction = lineEnd - lineStart;
+    float lineLength = sqrt(dot(direction, direction));
+    vec2 axis = lineLength > 0.0 ? direction / lineLength : vec2(1.0, 0.0);
+    vec2 perpendicular = vec2(-axis.y, axis.x) * (thickness * 0.5);
+
+    // Zero-length lines become a thickness-sized square centred on the start point
+    vec2 along = lineLength > 0.0 ? direction * a_position.x : axis * (thickness * 0.5) * (a_position.x * 2.0 - 1.0);
+    vec2 position = lineStart + along + perpendicular * (1.0 - 2.0 * a_position.y);
+
+    gl_Position = mul(u_modelViewProj, vec4(position, 0.0, 1.0));
+    v_color0 = i_data1;
+    v_texcoord0 = a_position;
+    v_texcoord1 = vec4(bloomIntensity * 1.5, 1.2, 0.5, thickness);
+}